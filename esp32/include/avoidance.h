@@ -0,0 +1,71 @@
+/**
+ * 巡逻避障引擎（事件驱动）
+ *
+ * - 每个新的传感器样本调用一次 onSample()，当场决定动作，反应时间 = 一个传感器周期
+ * - 超声波距离决定车速（离障碍越近越慢）和是否需要转向/后退；
+ *   STM32 标记为不可信的距离不触发避让，只限速
+ * - 红外避障左右标志决定转向方向；两侧都无信息时转向最近较少被挡的一侧，
+ *   连续避让时保持同一方向，避免在墙角左右摇摆
+ * - 前进命令分段下发（AVOID_CRUISE_MS），传感器中断时 STM32 到时自动停车
+ * - 纯逻辑，不直接发命令，由调用者把 AvoidAction 转成 STM32 命令
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// ============ 配置 ============
+#define AVOID_STOP_MM       200     // 小于该距离：先后退
+#define AVOID_TURN_MM       350     // 小于该距离：转向
+#define AVOID_FREE_MM       1000    // 大于该距离：全速
+#define AVOID_PWM_MIN       40      // 接近障碍时的最低速度
+#define AVOID_PWM_MAX       100
+#define AVOID_TURN_PWM      80      // 转向/后退速度
+#define AVOID_PWM_UNSURE    60      // 超声波结果不可信时的限速（只靠红外避障）
+#define AVOID_PWM_STEP      10      // 速度变化超过该值才重发前进命令
+#define AVOID_CRUISE_MS     400     // 单条前进命令时长
+#define AVOID_REFRESH_MS    150     // 前进命令剩余时间少于该值时续发
+#define AVOID_TURN_MS       350     // 单次转向时长
+#define AVOID_BACK_MS       300     // 后退时长
+#define AVOID_SAME_SIDE_MS  1500    // 该时间内再次避让沿用上次方向
+#define AVOID_STALE_MS      300     // 超过该时间没有新样本：停车等待
+
+struct AvoidSample {
+    int distanceMm;         // 超声波距离，0=无回波（前方空旷）
+    bool distanceValid;     // 距离不可信时不据此转向，前进限速
+    bool obsLeft;           // 左侧红外检测到障碍
+    bool obsRight;
+    unsigned long at;       // 收到样本的时间（millis）
+};
+
+struct AvoidAction {
+    enum Type : uint8_t { NONE, FORWARD, TURN_LEFT, TURN_RIGHT, BACK, STOP } type;
+    uint8_t pwm;
+    uint16_t ms;
+};
+
+class AvoidanceEngine {
+public:
+    void reset();
+
+    // 新样本到达
+    AvoidAction onSample(const AvoidSample& s);
+    // 没有新样本的控制周期：传感器中断时停车
+    AvoidAction onTick(unsigned long now, unsigned long lastSampleAt);
+
+    static uint8_t speedFor(int distanceMm);
+
+private:
+    enum State : uint8_t { IDLE, CRUISE, TURN, BACK };
+
+    AvoidAction turn(const AvoidSample& s);
+    AvoidAction act(AvoidAction::Type type, uint8_t pwm, uint16_t ms, unsigned long now);
+
+    State state_ = IDLE;
+    unsigned long busyUntil_ = 0;    // 当前命令预计结束时间
+    uint8_t cruisePwm_ = 0;
+    bool lastTurnLeft_ = false;
+    unsigned long lastTurnAt_ = 0;
+    unsigned long leftBlockedAt_ = 0;
+    unsigned long rightBlockedAt_ = 0;
+};
@@ -0,0 +1,100 @@
+/**
+ * 控制任务共享类型
+ *
+ * 网络任务、WebSocket 推送和控制任务之间传递的消息与快照
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "dead_reckoning.h"
+#include "seqlock.h"
+#include "spsc_ring.h"
+#include "stm32_cmd.h"
+
+// 自主导航状态
+enum RobotMode {
+    MODE_IDLE = 0,      // 空闲
+    MODE_MANUAL = 1,    // 手动控制
+    MODE_PATROL = 2,    // 自主巡逻
+    MODE_FOLLOW = 3,    // 跟随模式
+    MODE_RETURN = 4     // 返航
+};
+
+inline const char* robotModeName(RobotMode mode) {
+    static const char* const names[] = {"idle", "manual", "patrol", "follow", "return"};
+    return (mode >= MODE_IDLE && mode <= MODE_RETURN) ? names[mode] : "unknown";
+}
+
+// 名称或数字（"patrol" / "2"）→ 模式
+inline bool robotModeFromName(const char* name, RobotMode* out) {
+    for (int m = MODE_IDLE; m <= MODE_RETURN; m++) {
+        char digit[2] = {(char)('0' + m), '\0'};
+        if (strcmp(name, robotModeName((RobotMode)m)) == 0 || strcmp(name, digit) == 0) {
+            *out = (RobotMode)m;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============ 任务间通信 ============
+// 其他任务 → 控制任务：运动命令/透传命令/速度设定值/模式切换
+struct ControlMsg {
+    enum Type : uint8_t { MOTION, TEXT, VELOCITY, MODE } type;
+    Stm32Cmd cmd;               // MOTION
+    char text[STM32_CMD_MAX_LEN - 1];   // TEXT：原样发送的调试命令（已校验，见 stm32TextCmdValid；发送时再加 '\n'）
+    int16_t speed;
+    uint16_t duration;
+    RobotMode mode;
+    int8_t left, right;         // VELOCITY：-100~100
+};
+
+// 每个生产者一条单生产者单消费者队列
+typedef SpscRing<ControlMsg, 16> ControlQueue;
+extern ControlQueue netToControl;   // HTTP 处理函数（网络任务）
+extern ControlQueue wsToControl;    // WebSocket 消息（async_tcp 任务）
+
+// 传感器数据
+struct SensorSnapshot {
+    int distance;
+    bool distanceValid;         // STM32 滤波结果可信（旧固件恒为 true）
+    bool leftIR, rightIR;
+    bool leftTrack, rightTrack;
+    unsigned long updatedAt;    // ESP32 收到的时间
+    uint32_t sampleMs;          // STM32 采样时间（STM32 上电毫秒数，0=未知）
+    uint8_t fields;             // 本次数据实际带有的字段，见 SENSOR_HAS_*
+};
+
+// SensorSnapshot::fields（旧固件不带的字段保持默认值或上一次的值）
+#define SENSOR_HAS_DIST     0x01
+#define SENSOR_HAS_OBS      0x02    // 红外避障 OL/OR（旧格式 L/R）
+#define SENSOR_HAS_TRACK    0x04    // 红外循迹 TL/TR
+#define SENSOR_HAS_STAMP    0x08    // STM32 采样时间 T
+#define SENSOR_HAS_VALID    0x10    // 距离可信标志 V
+
+// 控制周期抖动统计（一个窗口内）
+struct TickStats {
+    uint32_t ticks;
+    uint32_t overruns;       // 处理耗时超过周期
+    int32_t maxLateUs;       // 最大偏差
+    uint32_t avgJitterUs;    // 平均 |实际周期 - 设定周期|
+    uint32_t maxWorkUs;      // 单次处理最大耗时
+};
+
+// 控制任务 → 其他任务：状态快照（顺序锁，读者不阻塞写者）
+struct ControlStatus {
+    SensorSnapshot sensor;
+    bool stm32Connected;
+    RobotMode mode;
+    char lastAck[32];
+    uint32_t ackRtt;
+    uint32_t ackTimeouts;
+    uint32_t frameErrors;
+    uint32_t sensorRejects;  // 格式错误被丢弃的 SENSOR 行
+    TickStats tick;
+    Pose pose;               // 航位推算位姿
+    uint32_t crumbs;         // 返航路点数
+};
+extern Seqlock<ControlStatus> controlStatus;
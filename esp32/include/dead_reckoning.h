@@ -0,0 +1,102 @@
+/**
+ * 航位推算（返航用）
+ *
+ * - 没有编码器反馈，按发给 STM32 的运动命令（方向、PWM、时长）和标定速度积分位姿
+ * - 与 STM32 的执行语义一致：F/B/L/R 打断当前运动和运动段队列，SEQ 追加到队尾，
+ *   S/SA 立即停止；被打断的命令只积分已经执行的部分
+ * - V 速度设定值按两轮差速积分，保持到下一个设定值；超过看门狗时间没有新设定值
+ *   视为 STM32 已停车
+ * - 每走过 DR_CRUMB_SPACING_MM 记一个路点（面包屑），存放在 PSRAM 环形缓冲区，
+ *   写满后覆盖最早的路点；返航时从最新的路点倒序走回原点
+ * - 只在控制任务中使用，不加锁
+ *
+ * 坐标系：开机位置为原点，车头朝 +x，逆时针为正航向。
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+// ============ 标定参数（默认 PWM 下实测） ============
+#define DR_DEFAULT_PWM          80      // STM32 固件默认 PWM（命令不带速度时）
+#define DR_SPEED_F_MM_S         250     // 前进速度
+#define DR_SPEED_B_MM_S         230     // 后退速度
+#define DR_TURN_L_DEG_S         120     // 左转角速度（只有右轮转，绕左轮原地转）
+#define DR_TURN_R_DEG_S         120     // 右转角速度
+#define DR_WHEEL_BASE_MM        130     // 两轮中心距（单轮转向时车体中心的位移）
+
+// ============ 路点 ============
+#define DR_CRUMB_CAPACITY       16384   // PSRAM 中的路点数（4 字节/个）
+#define DR_CRUMB_FALLBACK       256     // 没有 PSRAM 时的路点数
+#define DR_CRUMB_SPACING_MM     200     // 相邻路点间距
+#define DR_SEG_QUEUE            16      // 与 STM32 运动段队列深度一致
+
+struct Pose {
+    float x, y;         // mm
+    float heading;      // rad，(-π, π]
+};
+
+// 紧凑路点：cm，覆盖 ±327m
+struct Breadcrumb {
+    int16_t x, y;
+};
+
+class DeadReckoning {
+public:
+    // 分配路点缓冲区（优先 PSRAM），失败返回 false（仍可积分位姿，只是不记路点）
+    bool begin();
+
+    // 发给 STM32 的命令（发送成功后调用）
+    void onMotion(char dir, uint8_t pwm, uint16_t ms, unsigned long now);
+    void onSegments(const char* seq, unsigned long now);    // "F300,L400@60,..."
+    // 两轮 PWM（-100~100），deadmanMs 后视为停车（与 STM32 的 DEADMAN 一致）
+    void onVelocity(int8_t left, int8_t right, uint16_t deadmanMs, unsigned long now);
+    void onStop(unsigned long now);
+
+    // 每个控制周期调用：积分到 now，按间距记路点
+    void update(unsigned long now);
+
+    const Pose& pose() const { return pose_; }
+    // 估计中 STM32 还在执行运动命令
+    bool moving() const { return active_; }
+
+    // 返航期间不记路点
+    void setRecording(bool on) { recording_ = on; }
+
+    size_t crumbCount() const { return crumbCount_; }
+    size_t crumbCapacity() const { return crumbCap_; }
+    // 最新的路点（返航的下一个目标）
+    bool peekCrumb(Breadcrumb* out) const;
+    void popCrumb();
+    void clearCrumbs();
+
+private:
+    struct Segment {
+        char dir;           // F/B/L/R/S，V = 速度设定值
+        uint8_t pwm;
+        uint16_t ms;
+        int8_t left, right; // V
+    };
+
+    void start(const Segment& seg, unsigned long at);
+    void integrate(const Segment& seg, uint32_t ms);
+    void dropCrumb();
+
+    Pose pose_ = {0, 0, 0};
+
+    bool active_ = false;
+    Segment current_ = {};
+    unsigned long startedAt_ = 0;
+    uint32_t appliedMs_ = 0;         // 当前段已积分的时长
+
+    Segment queue_[DR_SEG_QUEUE];
+    size_t queueHead_ = 0;
+    size_t queueCount_ = 0;
+
+    Breadcrumb* crumbs_ = nullptr;
+    size_t crumbCap_ = 0;
+    size_t crumbHead_ = 0;           // 下一个写入位置
+    size_t crumbCount_ = 0;
+    bool recording_ = true;
+    float lastCrumbX_ = 0, lastCrumbY_ = 0;
+};
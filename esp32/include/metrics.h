@@ -0,0 +1,87 @@
+/**
+ * 运行指标：延迟直方图 + 计数器，/metrics 以 Prometheus 文本格式导出
+ *
+ * - 直方图按 HDR 思路分桶：每个 2 的幂区间再等分 4 份，相对误差 ≤25%，
+ *   1us ~ 134s 共 104 个桶，记录一次只是一次原子加，任何任务都可以调用
+ * - 导出时按固定的 le 边界（秒）累加内部桶，边界落在桶中间时整个桶计入该 le
+ *   （往返时间只有 ms 分辨率，整数 ms 正好落在 le 上时不会被漏算）
+ * - 指标：STM32 命令往返时间（按命令类型）、应答超时、心跳失败、
+ *   HTTP 处理耗时（按路由）、控制周期；堆内存等瞬时值由调用者导出时附加
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <functional>
+
+// ============ 配置 ============
+#define METRICS_HIST_BUCKETS    104     // 8 个线性桶 + 24 个 2 的幂区间 × 4
+#define METRICS_MAX_ROUTES      20      // HTTP 路由数上限，超出的合并到 "other"
+
+// STM32 命令类型（直方图/计数器的 cmd 标签）
+enum MetricsCmd : uint8_t {
+    METRICS_CMD_MOTION = 0,     // F/B/L/R/V
+    METRICS_CMD_STOP,           // S/SA
+    METRICS_CMD_SEQ,            // SEQ
+    METRICS_CMD_SENSOR,         // SENSOR
+    METRICS_CMD_PING,           // PING（心跳）
+    METRICS_CMD_CONFIG,         // STREAM/BIN/RAMP 等设置类命令
+    METRICS_CMD_COUNT
+};
+
+class LatencyHistogram {
+public:
+    void record(uint32_t us);
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t sumUs() const { return sum_.load(std::memory_order_relaxed); }
+    // 不大于 us 的记录数（按内部桶下界，最多多算一个桶）
+    uint64_t countBelow(uint32_t us) const;
+
+    static size_t bucketOf(uint32_t us);
+    static uint32_t bucketLower(size_t bucket);   // 桶内最小值
+
+private:
+    std::atomic<uint32_t> buckets_[METRICS_HIST_BUCKETS] = {};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+};
+
+// 导出目标：调用者实现（如分块写 HTTP 响应）
+class MetricsSink {
+public:
+    virtual void write(const char* s, size_t len) = 0;
+    void printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Metrics {
+public:
+    // STM32 链路（控制任务）
+    void stm32Rtt(const char* cmd, uint32_t rttMs);
+    void stm32Timeout(const char* cmd);
+    void pong(bool ok, uint32_t rttMs);
+    // 控制任务实际周期
+    void controlPeriod(uint32_t us) { controlPeriod_.record(us); }
+    void controlOverrun() { overruns_.fetch_add(1, std::memory_order_relaxed); }
+
+    // HTTP：包装处理函数，记录耗时（注册路由时调用，只在 setup 中使用）
+    std::function<void(void)> timed(const char* route, std::function<void(void)> handler);
+
+    // 输出所有直方图和计数器
+    void render(MetricsSink& out) const;
+
+    static MetricsCmd classify(const char* cmd);
+
+private:
+    LatencyHistogram rtt_[METRICS_CMD_COUNT];
+    std::atomic<uint32_t> timeouts_[METRICS_CMD_COUNT] = {};
+    std::atomic<uint32_t> pongFailures_{0};
+    LatencyHistogram controlPeriod_;
+    std::atomic<uint32_t> overruns_{0};
+
+    const char* routes_[METRICS_MAX_ROUTES + 1] = {};
+    LatencyHistogram http_[METRICS_MAX_ROUTES + 1];
+    size_t routeCount_ = 0;
+};
+
+extern Metrics metrics;
@@ -0,0 +1,18 @@
+/**
+ * STM32 传感器行解析（文本协议）
+ *
+ * 一次扫描、不分配内存，直接解析 Stm32Link 行缓冲区里的数据：
+ *   新格式  SENSOR,D<dist>,OL<l>OR<r>,TL<l>TR<r>[,T<ms>][,V<0/1>]
+ *   旧格式  SENSOR,D<dist>,L<l>R<r>
+ * - 字段用逗号分隔，顺序不限；D 必须有，其余缺失时不置对应的 SENSOR_HAS_* 位
+ * - 已知字段格式错误（非数字、电平不是 0/1、数值溢出、空字段）整行拒绝，
+ *   大写字母开头的未知字段跳过，留给以后的固件扩展
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "control.h"
+
+// 解析成功返回 true 并填写 out（updatedAt 由调用者填写）；失败时 out 不变
+bool parseSensorLine(const char* line, size_t len, SensorSnapshot* out);
@@ -0,0 +1,47 @@
+/**
+ * 顺序锁（单写者，多读者）
+ *
+ * - 写者从不阻塞，读者在读到一半被改写时自动重试
+ * - 适合控制任务发布快照、网络任务读取的场景
+ * - T 必须可平凡拷贝
+ */
+
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <type_traits>
+
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock 只能保存可平凡拷贝的类型");
+
+public:
+    // 仅限单个写者调用
+    void write(const T& value) {
+        uint32_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        data_ = value;
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    T read() const {
+        T copy;
+        uint32_t before, after;
+        do {
+            before = seq_.load(std::memory_order_acquire);
+            copy = data_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = seq_.load(std::memory_order_relaxed);
+        } while ((before & 1) || before != after);
+        return copy;
+    }
+
+    // 写入次数，可用于判断快照是否有变化
+    uint32_t version() const { return seq_.load(std::memory_order_acquire) >> 1; }
+
+private:
+    T data_{};
+    std::atomic<uint32_t> seq_{0};
+};
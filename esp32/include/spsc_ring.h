@@ -0,0 +1,59 @@
+/**
+ * 单生产者/单消费者无锁环形缓冲区
+ *
+ * - 容量 N 必须是 2 的幂，实际可用 N-1 个元素
+ * - 生产者只写 head，消费者只写 tail，无需加锁
+ * - 可用于 ISR/回调任务 → 主循环 的数据传递
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+template <typename T, size_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing 容量必须是 2 的幂");
+
+public:
+    // 生产者：写入一个元素，满时返回 false
+    bool push(const T& item) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t next = (head + 1) & (N - 1);
+        if (next == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        buf_[head] = item;
+        head_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // 消费者：取出一个元素，空时返回 false
+    bool pop(T& item) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = buf_[tail];
+        tail_.store((tail + 1) & (N - 1), std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    size_t size() const {
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        return (head - tail) & (N - 1);
+    }
+
+    static constexpr size_t capacity() { return N - 1; }
+
+private:
+    T buf_[N];
+    std::atomic<size_t> head_{0};
+    std::atomic<size_t> tail_{0};
+};
@@ -0,0 +1,199 @@
+/**
+ * ESP32 → STM32 命令编码（文本协议）
+ *
+ * 命令用 Stm32Cmd 枚举表示，运动命令的格式由编码策略在编译期选择（main.cpp 的 MOTION_PROTOCOL）：
+ *   SimpleProtocol    simo_robot_simple / simo_full 固件：F,<ms> / B,<ms> / L,<ms> / R,<ms>
+ *   MotionV1Protocol  simo_robot 固件：M,forward,<0.00~1.00>,<ms>
+ * S / PING / SENSOR / STREAM,<hz> / V,<左>,<右> 两种协议相同（V 只有 simo_full 支持）。
+ *
+ * 编码直接写入调用者的缓冲区（大小在编译期检查），参数先限幅再逐字符写出，
+ * 不经过 snprintf，也不会产生格式错误的命令。
+ * 没有枚举值的调试命令（BEEP、SEQ、DEADMAN 等）按原文透传，最长 STM32_CMD_MAX_LEN - 2 字节，
+ * 见 stm32TextCmdValid。
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum Stm32Cmd : uint8_t {
+    CMD_FORWARD = 0,    // 运动：speed 0~100（0 = 固件默认），arg = 持续时间 ms
+    CMD_BACKWARD,
+    CMD_LEFT,
+    CMD_RIGHT,
+    CMD_STOP,
+    CMD_PING,
+    CMD_SENSOR,
+    CMD_STREAM,         // 传感器流：arg = 上报频率 Hz（0 = 关闭）
+    CMD_VELOCITY        // 速度设定值：speed = 左轮，arg = 右轮（-100~100，正=向前）
+};
+
+#define STM32_CMD_MAX_LEN   32      // 编码结果最大长度（含 '\n' 和结尾 '\0'）
+
+inline bool stm32CmdIsMove(Stm32Cmd cmd) {
+    return cmd <= CMD_RIGHT;
+}
+
+// 运动/停止命令的单字母名（也是二进制 MOVE 帧的 dir 字节）
+inline char stm32CmdLetter(Stm32Cmd cmd) {
+    static const char letters[] = {'F', 'B', 'L', 'R', 'S'};
+    return cmd <= CMD_STOP ? letters[cmd] : 0;
+}
+
+// 命令名（"F" / "PING" / "SENSOR"，不含参数）→ 枚举；STREAM 需要参数，不按名字解析
+inline bool stm32CmdFromName(const char* name, size_t len, Stm32Cmd* out) {
+    if (len == 1) {
+        static const char letters[] = "FBLRS";
+        const char* p = (const char*)memchr(letters, name[0], 5);
+        if (!p) return false;
+        *out = (Stm32Cmd)(p - letters);
+        return true;
+    }
+    if (len == 4 && memcmp(name, "PING", 4) == 0) {
+        *out = CMD_PING;
+        return true;
+    }
+    if (len == 6 && memcmp(name, "SENSOR", 6) == 0) {
+        *out = CMD_SENSOR;
+        return true;
+    }
+    return false;
+}
+
+// 速度设定值 "<左>,<右>"（V 命令的参数部分），两个值都在 -100~100 内才接受
+inline bool stm32ParseVelocity(const char* text, int8_t* left, int8_t* right) {
+    char* end;
+    long l = strtol(text, &end, 10);
+    if (end == text || *end != ',') return false;
+    const char* p = end + 1;
+    long r = strtol(p, &end, 10);
+    if (end == p || *end != '\0' || l < -100 || l > 100 || r < -100 || r > 100) return false;
+    *left = (int8_t)l;
+    *right = (int8_t)r;
+    return true;
+}
+
+// 透传命令：非空、可打印 ASCII、不超过 maxLen 字节（换行由发送方添加）
+inline bool stm32TextCmdValid(const char* text, size_t maxLen) {
+    size_t n = 0;
+    for (; text[n]; n++) {
+        if (n >= maxLen || text[n] < 0x20 || text[n] > 0x7E) return false;
+    }
+    return n > 0;
+}
+
+namespace stm32cmd {
+
+inline char* putUint(char* p, uint32_t v) {
+    char tmp[10];
+    int n = 0;
+    do {
+        tmp[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    while (n) *p++ = tmp[--n];
+    return p;
+}
+
+inline char* putStr(char* p, const char* s) {
+    while (*s) *p++ = *s++;
+    return p;
+}
+
+inline char* putInt(char* p, int v) {
+    if (v < 0) {
+        *p++ = '-';
+        return putUint(p, (uint32_t)-v);
+    }
+    return putUint(p, (uint32_t)v);
+}
+
+// 持续时间 / 频率：STM32 端按 uint16 解析
+inline uint16_t clampU16(int v) {
+    return v < 0 ? 0 : (v > 65535 ? 65535 : (uint16_t)v);
+}
+
+// 速度设定值
+inline int8_t clampVel(int v) {
+    return v < -100 ? -100 : (v > 100 ? 100 : (int8_t)v);
+}
+
+}  // namespace stm32cmd
+
+// ============ 运动命令编码策略 ============
+// pwm(speed)：实际发给 STM32 的 PWM（0 = 固件默认），同时用于航位推算
+// encodeMove(p, dir, pwm, ms)：写出不含 '\n' 的命令，返回写入末尾
+
+// simple：F,<ms>，不带速度，STM32 用固件默认 PWM
+struct SimpleProtocol {
+    static uint8_t pwm(int speed) {
+        (void)speed;
+        return 0;
+    }
+
+    static char* encodeMove(char* p, Stm32Cmd dir, uint8_t pwm, uint16_t ms) {
+        (void)pwm;
+        *p++ = stm32CmdLetter(dir);
+        *p++ = ',';
+        return stm32cmd::putUint(p, ms);
+    }
+};
+
+// m-v1：M,forward,0.50,<ms>，速度 0~100 写成两位小数（超过 100 按 1.00）
+struct MotionV1Protocol {
+    static uint8_t pwm(int speed) {
+        return speed < 0 ? 0 : (speed > 100 ? 100 : (uint8_t)speed);
+    }
+
+    static char* encodeMove(char* p, Stm32Cmd dir, uint8_t pwm, uint16_t ms) {
+        static const char* const names[] = {"forward", "backward", "left", "right"};
+        p = stm32cmd::putStr(p, "M,");
+        p = stm32cmd::putStr(p, names[dir]);
+        *p++ = ',';
+        *p++ = (char)('0' + pwm / 100);
+        *p++ = '.';
+        *p++ = (char)('0' + pwm % 100 / 10);
+        *p++ = (char)('0' + pwm % 10);
+        *p++ = ',';
+        return stm32cmd::putUint(p, ms);
+    }
+};
+
+// 编码一条命令（带 '\n' 和结尾 '\0'），返回不含 '\0' 的长度
+template <typename Protocol, size_t N>
+size_t encodeStm32Cmd(char (&buf)[N], Stm32Cmd cmd, int speed, int arg) {
+    static_assert(N >= STM32_CMD_MAX_LEN, "命令缓冲区至少 STM32_CMD_MAX_LEN 字节");
+    char* p = buf;
+
+    switch (cmd) {
+    case CMD_STOP:
+        *p++ = 'S';
+        break;
+    case CMD_PING:
+        p = stm32cmd::putStr(p, "PING");
+        break;
+    case CMD_SENSOR:
+        p = stm32cmd::putStr(p, "SENSOR");
+        break;
+    case CMD_STREAM:
+        p = stm32cmd::putStr(p, "STREAM,");
+        p = stm32cmd::putUint(p, stm32cmd::clampU16(arg));
+        break;
+    case CMD_VELOCITY:
+        p = stm32cmd::putStr(p, "V,");
+        p = stm32cmd::putInt(p, stm32cmd::clampVel(speed));
+        *p++ = ',';
+        p = stm32cmd::putInt(p, stm32cmd::clampVel(arg));
+        break;
+    default:
+        p = Protocol::encodeMove(p, cmd, Protocol::pwm(speed), stm32cmd::clampU16(arg));
+        break;
+    }
+
+    *p++ = '\n';
+    *p = '\0';
+    return (size_t)(p - buf);
+}
@@ -0,0 +1,64 @@
+/**
+ * ESP32 ↔ STM32 二进制帧协议（见 docs/stm32-binary-protocol.md）
+ *
+ * 帧结构（COBS 编码前）：
+ *   [type:1][seq:1][payload:0~48][crc16:2 小端]
+ * COBS 编码后以 0x00 结尾，帧内不会出现 0x00，可随时重新同步。
+ * CRC-16/CCITT-FALSE（多项式 0x1021，初值 0xFFFF），覆盖 type..payload。
+ *
+ * 协商：文本模式下发送 "BIN\n"，STM32 回复 "OK,BIN" 后双方切换为二进制；
+ * 二进制模式下发送 FRAME_TEXT_MODE 切回文本。
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FRAME_MAX_PAYLOAD   48
+#define FRAME_MAX_RAW       (FRAME_MAX_PAYLOAD + 4)
+#define FRAME_MAX_ENCODED   (FRAME_MAX_RAW + FRAME_MAX_RAW / 254 + 2)   // 含结尾 0x00
+
+// ESP32 → STM32
+#define FRAME_MOVE          0x01    // [dir:'F'/'B'/'L'/'R'][pwm:0~100][ms:u16]
+#define FRAME_STOP          0x02
+#define FRAME_PING          0x03
+#define FRAME_SENSOR_REQ    0x04
+#define FRAME_VEL           0x05    // [left:i8][right:i8]，-100~100（simo_full）
+#define FRAME_TEXT          0x10    // [文本命令]，用于没有二进制编码的命令
+#define FRAME_TEXT_MODE     0x11    // 切回文本协议
+
+// STM32 → ESP32
+#define FRAME_ACK           0x81    // [status:0=OK/1=ERR][被应答的 type]
+#define FRAME_PONG          0x82
+#define FRAME_SENSOR        0x83    // [dist:u16, 0.1cm][flags][t:u32 ms，可选]
+#define FRAME_TEXT_REPLY    0x90    // [文本回复]
+
+// FRAME_SENSOR flags
+#define SENSOR_FLAG_OBS_L   0x01
+#define SENSOR_FLAG_OBS_R   0x02
+#define SENSOR_FLAG_TRK_L   0x04
+#define SENSOR_FLAG_TRK_R   0x08
+#define SENSOR_FLAG_DIST_BAD 0x10   // 距离不可信（STM32 滤波后一致样本不足）
+
+struct Stm32Frame {
+    uint8_t type;
+    uint8_t seq;
+    uint8_t len;
+    uint8_t payload[FRAME_MAX_PAYLOAD];
+};
+
+uint16_t crc16Ccitt(const uint8_t* data, size_t len);
+
+// COBS 编码，不写结尾 0x00；返回输出长度
+size_t cobsEncode(const uint8_t* in, size_t len, uint8_t* out);
+
+// COBS 解码（输入不含结尾 0x00）；格式错误或超出 outSize 返回 0
+size_t cobsDecode(const uint8_t* in, size_t len, uint8_t* out, size_t outSize);
+
+// 组帧：CRC + COBS + 结尾 0x00，out 至少 FRAME_MAX_ENCODED 字节；
+// 载荷过长返回 0
+size_t frameEncode(uint8_t type, uint8_t seq, const uint8_t* payload, size_t len, uint8_t* out);
+
+// 拆帧（输入不含结尾 0x00），COBS 或 CRC 错误返回 false
+bool frameDecode(const uint8_t* in, size_t len, Stm32Frame* frame);
@@ -0,0 +1,154 @@
+/**
+ * STM32 串口链路（非阻塞）
+ *
+ * - UART 事件回调把字节写入无锁环形缓冲区（不在 HTTP/主循环里等待）
+ * - poll() 在主循环中组装整行，按类型分发：
+ *     OK/ERR  → 命令应答（按回显的命令名匹配，带往返时间）
+ *     SENSOR  → 传感器回调
+ *     PONG    → 心跳回调
+ *     其他    → 主动上报回调
+ * - 回调拿到的是行缓冲区内的指针视图，不做 String 分配；
+ *   指针只在回调期间有效
+ * - 支持协商切换到二进制帧协议（stm32_frame.h），切换后传感器数据
+ *   通过 onSensorData 回调给出，其他文本回复仍按行分发
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "spsc_ring.h"
+#include "stm32_frame.h"
+
+// ============ 配置 ============
+#define STM32_RX_RING_SIZE      1024   // 接收环形缓冲（2 的幂）
+#define STM32_RX_GAP            0x100  // 环形缓冲中的丢字节标记（不是有效字节）
+#define STM32_LINE_MAX          96     // 单行最大长度（含结束符）
+#define STM32_PENDING_MAX       8      // 同时等待应答的命令数
+#define STM32_ACK_TIMEOUT_MS    100    // 命令应答超时（从 STM32 预计执行完算起）
+#define STM32_PONG_TIMEOUT_MS   200    // 心跳应答超时
+
+enum Stm32LineType {
+    STM32_LINE_ACK = 0,     // OK,... / ERR,...
+    STM32_LINE_SENSOR,      // SENSOR,...
+    STM32_LINE_PONG,        // PONG
+    STM32_LINE_OTHER        // 启动信息、DIST/IR/TRACK/KEY 等
+};
+
+// 行回调：line 以 '\0' 结尾，已去除 \r\n
+typedef void (*Stm32LineHandler)(const char* line, size_t len);
+// 应答回调：超时时 line == nullptr
+typedef void (*Stm32AckHandler)(const char* cmd, const char* line, size_t len, uint32_t rttMs);
+// 心跳回调：ok=false 表示超时
+typedef void (*Stm32PongHandler)(bool ok, uint32_t rttMs);
+// 二进制传感器帧回调：distance 单位 0.1cm，flags 见 SENSOR_FLAG_*，
+// stampMs 为 STM32 采样时间（旧固件不带时间戳时为 0）
+typedef void (*Stm32SensorDataHandler)(uint16_t distance, uint8_t flags, uint32_t stampMs);
+
+class Stm32Link {
+public:
+    void begin(HardwareSerial& port);
+
+    // 主循环调用：组装并分发已收到的行、检查超时，从不阻塞
+    void poll();
+
+    // 发送一行（需带 '\n'）。期待 OK/ERR 的命令会进入应答队列，
+    // 队列满时返回 false。execMs：STM32 执行完才回复的命令（simo_robot_simple
+    // 阻塞执行运动命令）预计的执行时间，应答超时从执行完算起
+    bool send(const char* line, uint16_t execMs = 0);
+
+    // 发送二进制帧（仅二进制模式），tag 为应答显示用的命令名；
+    // ackExpected=false 的帧（PING/SENSOR_REQ）不进入应答队列
+    bool sendFrame(uint8_t type, const uint8_t* payload, size_t len,
+                   const char* tag, bool ackExpected = true);
+
+    // 停车（S / STOP 帧）：不受协议协商和应答队列限制——协商期间先记下，
+    // 结果出来后立即按对应协议发出；应答队列满时照样发送，只是不跟踪应答。
+    // send("S\n") 和 sendFrame(FRAME_STOP) 也走这里
+    void sendStop();
+
+    // 发送 PING，上一个心跳未返回时不重复发送
+    void ping();
+
+    // 请求切换到二进制协议（STM32 回复 OK,BIN 后生效；
+    // 回复 ERR 说明固件不支持，之后不再尝试）
+    void requestBinary();
+    // 切回文本协议
+    void revertToText();
+    bool binary() const { return binary_; }
+    bool binaryUnsupported() const { return binaryUnsupported_; }
+
+    void onAck(Stm32AckHandler h) { ackHandler_ = h; }
+    void onSensor(Stm32LineHandler h) { sensorHandler_ = h; }
+    void onPong(Stm32PongHandler h) { pongHandler_ = h; }
+    void onUnsolicited(Stm32LineHandler h) { otherHandler_ = h; }
+    void onSensorData(Stm32SensorDataHandler h) { sensorDataHandler_ = h; }
+
+    static Stm32LineType classify(const char* line, size_t len);
+
+    size_t pendingAcks() const { return pendingCount_; }
+    const char* lastAck() const { return lastAck_; }
+    uint32_t lastAckRtt() const { return lastAckRtt_; }
+    uint32_t ackTimeouts() const { return ackTimeouts_; }
+    uint32_t lateAcks() const { return lateAcks_; }
+    uint32_t rxOverflows() const { return rxOverflows_; }
+    uint32_t frameErrors() const { return frameErrors_; }
+
+private:
+    struct Pending {
+        char cmd[8];
+        uint8_t seq;
+        unsigned long sentAt;
+        unsigned long doneAt;       // STM32 预计执行完的时间（排在前面的命令执行完才轮到它）
+    };
+
+    void pumpUart();                 // UART 回调任务中执行
+    void feed(char c);
+    void feedBinary(uint8_t b);
+    void dispatch(const char* line, size_t len);
+    void dispatchFrame(const Stm32Frame& frame);
+    bool pushPending(const char* tag, uint8_t seq, uint16_t execMs = 0);
+    void dropPending(unsigned long now);
+    void completeAck(const char* line, size_t len);
+    static bool ackMatches(const char* cmd, const char* line, size_t len);
+    void completeFrameAck(const Stm32Frame& frame);
+    void expireTimeouts(unsigned long now);
+    void writeStop();
+    void flushHeldStop();
+    static bool expectsAck(const char* line);
+
+    HardwareSerial* port_ = nullptr;
+    SpscRing<uint16_t, STM32_RX_RING_SIZE> rx_;
+    bool rxGap_ = false;             // 有字节被丢弃、标记还没写进缓冲（只在 UART 回调任务中访问）
+
+    char line_[STM32_LINE_MAX];
+    size_t lineLen_ = 0;
+    bool lineDiscard_ = false;       // 行溢出，丢弃到下一个换行
+
+    Pending pending_[STM32_PENDING_MAX];
+    size_t pendingHead_ = 0;
+    size_t pendingCount_ = 0;
+
+    uint8_t frameBuf_[FRAME_MAX_ENCODED];
+    size_t frameLen_ = 0;
+    bool binary_ = false;
+    bool negotiating_ = false;
+    bool binaryUnsupported_ = false;
+    bool stopHeld_ = false;          // 协商期间收到的停车，协商结束后发出
+    uint8_t txSeq_ = 0;
+    uint32_t frameErrors_ = 0;
+
+    bool pingOutstanding_ = false;
+    unsigned long pingSentAt_ = 0;
+
+    char lastAck_[32] = "";
+    uint32_t lastAckRtt_ = 0;
+    uint32_t ackTimeouts_ = 0;
+    uint32_t lateAcks_ = 0;          // 找不到对应命令的应答（已超时命令迟到的应答等）
+    volatile uint32_t rxOverflows_ = 0;
+
+    Stm32AckHandler ackHandler_ = nullptr;
+    Stm32LineHandler sensorHandler_ = nullptr;
+    Stm32PongHandler pongHandler_ = nullptr;
+    Stm32LineHandler otherHandler_ = nullptr;
+    Stm32SensorDataHandler sensorDataHandler_ = nullptr;
+};
@@ -0,0 +1,97 @@
+/**
+ * 遥测历史记录（PSRAM 环形缓冲）
+ *
+ * - 控制任务每 TLOG_PERIOD_MS 记一条定长记录：传感器、模式、本周期发出的命令和应答往返时间
+ * - 缓冲区优先放在 PSRAM（默认约 109 分钟），写满后覆盖最早的记录
+ * - 单写者（控制任务）、多读者（网络任务）：写者从不阻塞，
+ *   读者拷贝记录后检查期间是否被覆盖，被覆盖的记录直接跳过
+ * - 读取按时间范围进行，可按固定时间桶降采样（每桶取最小/最大值），
+ *   现场出问题时通过 /telemetry 下载最近的历史，不需要接串口
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+// ============ 配置 ============
+#define TLOG_PERIOD_MS      50          // 记录间隔（与传感器流 20Hz 一致）
+#define TLOG_CAPACITY       131072      // PSRAM 中的记录数（16 字节/个，2MB，约 109 分钟）
+#define TLOG_FALLBACK       512         // 没有 PSRAM 时的记录数
+
+// 记录标志位
+#define TLOG_OBS_L          0x01        // 左侧红外避障触发
+#define TLOG_OBS_R          0x02
+#define TLOG_TRK_L          0x04        // 左侧循迹传感器（原始电平）
+#define TLOG_TRK_R          0x08
+#define TLOG_DIST_BAD       0x10        // 距离不可信
+#define TLOG_SENSOR_STALE   0x20        // 传感器数据过期
+#define TLOG_STM32_DOWN     0x40        // STM32 未连接
+
+// 一条记录（16 字节）
+struct TelemetryRecord {
+    uint32_t ms;            // millis()
+    uint16_t distance;      // 0.1cm
+    uint16_t rttMs;         // 本周期收到的应答中最大的往返时间，0=没有应答
+    uint8_t flags;          // TLOG_*
+    uint8_t mode;           // RobotMode
+    char cmd;               // 本周期最后发出的运动命令（F/B/L/R/S/V，SEQ 记为 Q），0=没有
+    uint8_t cmdCount;       // 本周期发出的运动命令数
+    uint16_t cmdMs;         // 最后一条命令的时长
+    uint8_t cmdPwm;         // 最后一条命令的 PWM，0=默认
+    uint8_t timeouts;       // 本周期应答超时数
+};
+
+// 降采样结果（20 字节，小端，即 /telemetry 二进制格式的一行）
+struct __attribute__((packed)) TelemetryBucket {
+    uint32_t ms;            // 桶起点（不降采样时为记录时间）
+    uint16_t count;         // 桶内记录数
+    uint16_t distMin, distMax;
+    uint16_t rttMin, rttMax;    // 都为 0 表示桶内没有应答
+    uint8_t flags;          // 桶内所有记录标志的或
+    uint8_t mode;           // 桶内最后一条记录的模式
+    uint8_t cmds;           // 桶内发出的运动命令数（饱和到 255）
+    char cmd;               // 桶内最后发出的运动命令，0=没有
+    uint8_t timeouts;       // 桶内应答超时数（饱和到 255）
+    uint8_t reserved;
+};
+
+// 读取位置（网络任务持有）
+struct TelemetryCursor {
+    uint32_t index;         // 下一条要读的记录序号
+    uint32_t toMs;          // 截止时间（含）
+    uint32_t bucketMs;      // 桶宽，0=不降采样
+};
+
+class TelemetryLog {
+public:
+    // 分配缓冲区（优先 PSRAM），失败返回 false（之后的调用都是空操作）
+    bool begin();
+
+    // ---- 写者（控制任务） ----
+    void noteCommand(char cmd, uint8_t pwm, uint16_t ms);
+    void noteAck(uint32_t rttMs, bool timeout);
+    // 每个控制周期调用，到 TLOG_PERIOD_MS 记一条
+    void sample(unsigned long now, int distance, uint8_t flags, uint8_t mode);
+
+    // ---- 读者（任意任务） ----
+    size_t capacity() const { return cap_; }
+    // 当前保存的记录数
+    size_t size() const;
+    // 从第一条时间不早于 fromMs 的记录开始
+    TelemetryCursor seek(uint32_t fromMs, uint32_t toMs, uint32_t bucketMs) const;
+    // 读出最多 max 个桶，返回个数，0=结束
+    size_t next(TelemetryCursor& cur, TelemetryBucket* out, size_t max) const;
+
+private:
+    bool read(uint32_t index, TelemetryRecord* out) const;
+    uint32_t oldest(uint32_t written) const;
+
+    TelemetryRecord* buf_ = nullptr;
+    size_t cap_ = 0;
+    std::atomic<uint32_t> written_{0};  // 累计写入的记录数，记录 i 在 buf_[i % cap_]
+
+    // 本周期累计（只有写者访问）
+    TelemetryRecord pending_ = {};
+    unsigned long lastSampleAt_ = 0;
+};
@@ -0,0 +1,29 @@
+/**
+ * WebSocket 遥测推送（ws://<ip>:81/ws）
+ *
+ * 下行：状态变化时推送增量 JSON（只含变化字段），每个客户端限速；
+ *       客户端发送队列满时跳过本次推送，下次推送累积的增量，
+ *       慢客户端不会拖住其他客户端或控制任务
+ * 上行：文本命令
+ *   F,<ms> / B,<ms> / L,<ms> / R,<ms> / S   运动命令
+ *   MODE,<idle|manual|patrol|follow|return>  模式切换
+ *   RATE,<hz>                                降低本连接推送频率
+ *
+ * 独立编译单元：ESPAsyncWebServer 与 WebServer.h 的 HTTP_* 枚举冲突，
+ * 不能出现在同一个 .cpp 中
+ */
+
+#pragma once
+
+#define WS_PORT             81
+#define WS_PUSH_MAX_HZ      10    // 每个客户端最大推送频率
+#define WS_MAX_CLIENTS      4
+
+// 网络任务启动时调用一次
+void telemetryWsBegin();
+
+// 网络任务循环中调用：检查快照变化并推送
+void telemetryWsLoop();
+
+// 当前连接数
+int telemetryWsClientCount();
@@ -0,0 +1,519 @@
+/**
+ * 预压缩网页（scripts/gzip_pages.py 由 web/ 下的 .html 生成，不要手工修改）
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+struct WebPage {
+    const uint8_t* gz;      // gzip 数据（flash）
+    size_t len;
+    const char* type;
+    const char* etag;       // 含引号，可直接用作 ETag 响应头
+};
+
+// index.html: 21543 -> 5770 字节
+static const uint8_t WEB_INDEX_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x3c, 0x6b, 0x77, 0x14, 0x55,
+    0xb6, 0xdf, 0xfd, 0x15, 0x65, 0xbb, 0xc6, 0xee, 0xd6, 0x54, 0xbf, 0x42, 0x62, 0x48, 0xa7, 0xe3,
+    0x12, 0x84, 0x25, 0x73, 0x41, 0xb2, 0x48, 0x7c, 0x2d, 0xc7, 0x35, 0xab, 0xd2, 0x75, 0x3a, 0x5d,
+    0x5a, 0x5d, 0xd5, 0x53, 0x55, 0x9d, 0x87, 0xac, 0xac, 0x15, 0x66, 0x46, 0x92, 0x20, 0x21, 0x70,
+    0xbd, 0x83, 0x0e, 0x82, 0x88, 0x83, 0xca, 0x38, 0x42, 0x70, 0x54, 0x88, 0x10, 0xe4, 0xbf, 0x38,
+    0xa9, 0xee, 0xf4, 0xa7, 0xcc, 0x4f, 0xb8, 0x7b, 0x9f, 0x53, 0xef, 0x3a, 0xfd, 0x08, 0xe0, 0x0c,
+    0x1f, 0xa0, 0xea, 0xd4, 0x39, 0x7b, 0xef, 0xb3, 0x5f, 0x67, 0xef, 0x7d, 0x76, 0x33, 0xf6, 0xf4,
+    0xcb, 0xc7, 0x0f, 0x4e, 0xbd, 0x35, 0x71, 0x48, 0xa8, 0x5a, 0x35, 0x75, 0xfc, 0xa9, 0x31, 0xf7,
+    0x1f, 0x22, 0xc9, 0xe3, 0x4f, 0x09, 0xf0, 0x67, 0xac, 0x46, 0x2c, 0x49, 0x28, 0x57, 0x25, 0xc3,
+    0x24, 0x56, 0x29, 0xf1, 0xda, 0xd4, 0x61, 0x71, 0x24, 0x11, 0xfc, 0xa4, 0x49, 0x35, 0x52, 0x4a,
+    0xcc, 0x2a, 0x64, 0xae, 0xae, 0x1b, 0x56, 0x42, 0x28, 0xeb, 0x9a, 0x45, 0x34, 0x98, 0x3a, 0xa7,
+    0xc8, 0x56, 0xb5, 0x24, 0x93, 0x59, 0xa5, 0x4c, 0x44, 0xfa, 0x32, 0x20, 0x28, 0x9a, 0x62, 0x29,
+    0x92, 0x2a, 0x9a, 0x65, 0x49, 0x25, 0xa5, 0x7c, 0x26, 0x37, 0x20, 0x34, 0x4c, 0x62, 0xd0, 0x77,
+    0x69, 0x1a, 0x86, 0x34, 0xdd, 0x05, 0x6e, 0x29, 0x96, 0x4a, 0xc6, 0x27, 0x95, 0x9a, 0x3e, 0x96,
+    0x65, 0xcf, 0x6c, 0xdc, 0xb4, 0x16, 0xdc, 0x67, 0xfc, 0x33, 0x6a, 0xe8, 0xba, 0x25, 0x9c, 0x14,
+    0x44, 0x51, 0x2a, 0x97, 0x01, 0xef, 0xa8, 0xf0, 0x4c, 0x2e, 0x27, 0xef, 0xaf, 0x54, 0x8a, 0x30,
+    0x34, 0x3d, 0x83, 0xaf, 0x72, 0x3e, 0x9f, 0x7f, 0x01, 0x5f, 0xcb, 0x92, 0x21, 0xc3, 0x40, 0x7e,
+    0x38, 0x3f, 0x5d, 0x28, 0xd0, 0xef, 0xba, 0x21, 0x13, 0x03, 0x86, 0x06, 0x73, 0x83, 0xc3, 0x83,
+    0x72, 0x51, 0x58, 0xf4, 0xe0, 0x3e, 0x07, 0x30, 0xa7, 0xf5, 0x79, 0xd1, 0x54, 0xde, 0x57, 0x34,
+    0x00, 0xc3, 0xa6, 0xc2, 0x8a, 0xf9, 0xa2, 0x50, 0x93, 0x8c, 0x19, 0x45, 0x1b, 0x15, 0x72, 0x45,
+    0xa1, 0x2e, 0xc9, 0x32, 0xfd, 0x9e, 0x0b, 0x2e, 0x9e, 0xd6, 0xe5, 0x05, 0x58, 0x5f, 0x01, 0x56,
+    0x88, 0x15, 0xa9, 0xa6, 0xa8, 0x0b, 0xa3, 0x82, 0x28, 0xd5, 0xeb, 0x2a, 0x11, 0xcd, 0x05, 0xd3,
+    0x22, 0xb5, 0x01, 0x81, 0xfd, 0x2b, 0x36, 0x14, 0x78, 0x94, 0x34, 0x53, 0x04, 0x2e, 0x28, 0x40,
+    0xf3, 0xb4, 0x54, 0x7e, 0x6f, 0xc6, 0xd0, 0x1b, 0x1a, 0x10, 0x3a, 0x2b, 0x19, 0x29, 0xdc, 0x43,
+    0xba, 0x08, 0x4c, 0x55, 0x75, 0xa4, 0x93, 0x0c, 0x13, 0xb9, 0x32, 0x08, 0x14, 0x28, 0x9a, 0x58,
+    0x25, 0xca, 0x4c, 0x15, 0xf6, 0x9b, 0xcf, 0xe5, 0x66, 0xab, 0x41, 0xec, 0xde, 0x43, 0xf6, 0x39,
+    0xa1, 0x7d, 0xed, 0x4e, 0xfb, 0x4f, 0x37, 0x5a, 0x67, 0xee, 0x34, 0x97, 0x4e, 0x35, 0x3f, 0x5f,
+    0x17, 0x9e, 0xcb, 0x7a, 0x5f, 0x33, 0x28, 0x64, 0x62, 0xe0, 0x3e, 0x63, 0x48, 0x91, 0x53, 0xe9,
+    0xc0, 0xee, 0xf2, 0x85, 0xfa, 0xbc, 0x90, 0x1f, 0xae, 0xc3, 0xe6, 0x65, 0xc5, 0xac, 0xab, 0x12,
+    0x6c, 0xa8, 0xa2, 0x12, 0x78, 0x7d, 0xb7, 0x61, 0x5a, 0x4a, 0x65, 0x41, 0x74, 0xc4, 0x3e, 0x2a,
+    0x98, 0x75, 0x09, 0xe4, 0x3d, 0x4d, 0xac, 0x39, 0x42, 0xb4, 0xa2, 0x20, 0xa9, 0xca, 0x8c, 0x26,
+    0x2a, 0xb0, 0x57, 0x73, 0x54, 0x40, 0x01, 0x11, 0xa3, 0xe8, 0x33, 0xd3, 0xb2, 0xf4, 0x1a, 0x40,
+    0x07, 0xe0, 0xa6, 0xae, 0x2a, 0xb2, 0xbb, 0x65, 0xfa, 0x19, 0xf1, 0xeb, 0x26, 0xe8, 0x8b, 0x0e,
+    0xac, 0x06, 0x24, 0xe5, 0xf7, 0x16, 0x8a, 0x82, 0xa5, 0xd7, 0x29, 0xaf, 0xdf, 0x17, 0x15, 0x4d,
+    0x26, 0xf3, 0x74, 0xf7, 0xc1, 0xbd, 0x67, 0x54, 0x7d, 0x46, 0x77, 0x59, 0x0f, 0xb2, 0x23, 0xa3,
+    0x42, 0x21, 0x87, 0x64, 0xd3, 0x81, 0x39, 0x87, 0x65, 0xc3, 0xbc, 0x45, 0x40, 0xb8, 0x06, 0x2b,
+    0x1d, 0x56, 0x33, 0x4a, 0x98, 0x4e, 0xa5, 0x43, 0x93, 0x4d, 0x4b, 0xb2, 0x1a, 0xa6, 0x28, 0xeb,
+    0x96, 0x09, 0xd3, 0x23, 0xec, 0x98, 0x91, 0x80, 0xbe, 0x11, 0x44, 0x18, 0x58, 0x21, 0x53, 0x0d,
+    0xa5, 0x26, 0x80, 0x04, 0xe3, 0x57, 0x5f, 0x78, 0xf8, 0xe6, 0xf0, 0xc3, 0x90, 0x64, 0xa5, 0x01,
+    0x6c, 0x1a, 0xca, 0xfd, 0x26, 0xac, 0x09, 0xcf, 0xec, 0x1b, 0xd9, 0x57, 0x19, 0x1a, 0x89, 0x02,
+    0xcd, 0xe8, 0x5a, 0x44, 0x7a, 0xcf, 0x0c, 0x56, 0xa6, 0xf7, 0x0f, 0xe5, 0x62, 0x13, 0xe7, 0x24,
+    0x23, 0x36, 0x55, 0x2e, 0xec, 0xdf, 0x8f, 0x66, 0xc0, 0x57, 0x9c, 0xed, 0xcd, 0xfb, 0xf6, 0xe9,
+    0x0f, 0xec, 0x5b, 0x3f, 0xd9, 0x67, 0xef, 0x85, 0xb4, 0xa6, 0x26, 0x29, 0x08, 0xca, 0x57, 0x0d,
+    0xaa, 0x15, 0x35, 0x69, 0x5e, 0x74, 0x36, 0x38, 0x94, 0xcb, 0xd5, 0x83, 0x46, 0x22, 0x48, 0x0d,
+    0x4b, 0xef, 0x84, 0xc6, 0x5e, 0xbb, 0xd6, 0x5a, 0x5d, 0x0e, 0x21, 0x40, 0xdd, 0xeb, 0xa6, 0x94,
+    0xae, 0xd1, 0x76, 0xd4, 0x9a, 0x08, 0x37, 0x51, 0x77, 0x8b, 0x71, 0x7a, 0x91, 0x3a, 0x5f, 0x03,
+    0x87, 0x23, 0x22, 0x43, 0x5c, 0x22, 0x75, 0x3b, 0x61, 0x65, 0xca, 0xef, 0xc3, 0x89, 0xae, 0x39,
+    0x8e, 0x4c, 0xef, 0xdf, 0xb7, 0x9f, 0xc4, 0xa1, 0x15, 0x38, 0x86, 0xc2, 0x35, 0x04, 0x9e, 0xba,
+    0x04, 0xd9, 0xd3, 0x3c, 0xf7, 0xb5, 0xbd, 0x72, 0xa7, 0x7d, 0xe5, 0x8b, 0xe6, 0x95, 0x87, 0x61,
+    0x26, 0x01, 0x49, 0x86, 0xae, 0x86, 0x34, 0x70, 0xc6, 0x50, 0xc0, 0x85, 0xe1, 0xdf, 0x22, 0x60,
+    0x81, 0x31, 0x8b, 0x80, 0x59, 0xaa, 0x8d, 0x9a, 0x06, 0x18, 0x0d, 0x52, 0x27, 0x92, 0x95, 0x1a,
+    0x1c, 0x10, 0xf2, 0x15, 0x64, 0x92, 0x8f, 0x39, 0x20, 0xba, 0xc2, 0xbe, 0x1e, 0xa2, 0xcb, 0x94,
+    0x2d, 0x43, 0x15, 0xa7, 0x2d, 0xd4, 0x00, 0x57, 0x85, 0x5f, 0x08, 0xa8, 0xf0, 0xa8, 0xa0, 0xe9,
+    0x1a, 0xe9, 0x20, 0x82, 0xa0, 0x4d, 0x32, 0x36, 0x36, 0x0c, 0x13, 0xf9, 0x58, 0xd7, 0x15, 0xc7,
+    0x2f, 0x04, 0xf5, 0xb3, 0x90, 0x2f, 0x0c, 0x17, 0xe4, 0x62, 0x07, 0x83, 0xb4, 0x0c, 0xf0, 0x9a,
+    0x8e, 0x73, 0x90, 0x54, 0x55, 0xc8, 0x65, 0xf2, 0x43, 0x26, 0x97, 0xd4, 0x51, 0xa9, 0x6c, 0x29,
+    0xb3, 0x28, 0x47, 0xba, 0xa6, 0xa2, 0x1b, 0x20, 0x22, 0x7a, 0x00, 0xa5, 0x72, 0x99, 0xfd, 0x43,
+    0xe9, 0x08, 0xda, 0xf8, 0x51, 0xe0, 0x41, 0x02, 0xd3, 0xd7, 0xeb, 0x51, 0x33, 0x9a, 0x1e, 0x2e,
+    0x0c, 0x16, 0xf6, 0xf9, 0x3a, 0x51, 0xc1, 0xa3, 0x87, 0xb7, 0x18, 0x44, 0x62, 0xe1, 0xa9, 0x30,
+    0xab, 0x98, 0xca, 0xb4, 0xa2, 0x2a, 0x16, 0x88, 0xac, 0xaa, 0xc8, 0x32, 0x7a, 0xc9, 0x0e, 0xd2,
+    0xbf, 0xb0, 0xdc, 0xbc, 0x72, 0x3a, 0x24, 0xf7, 0x77, 0xf5, 0x05, 0xea, 0x0a, 0xd1, 0x02, 0x3d,
+    0xe7, 0x68, 0x10, 0x90, 0x35, 0x6c, 0xb1, 0xe8, 0xfa, 0x98, 0x42, 0x2e, 0xe4, 0x64, 0x0a, 0x7c,
+    0x8b, 0xec, 0xe9, 0x75, 0xdc, 0x93, 0xb3, 0xa7, 0xc5, 0x59, 0x7a, 0xa3, 0x5c, 0x15, 0x91, 0xcf,
+    0x48, 0x0e, 0x53, 0x81, 0x00, 0x0b, 0xde, 0xd3, 0xf4, 0xe9, 0x10, 0xc1, 0xd2, 0x34, 0x80, 0x69,
+    0x58, 0x30, 0x4b, 0x25, 0x15, 0x4f, 0x85, 0xa8, 0x6f, 0x67, 0x8f, 0xce, 0x3e, 0x86, 0x43, 0xdb,
+    0x18, 0xee, 0xcf, 0x57, 0xba, 0x7a, 0xe3, 0x52, 0x5d, 0x88, 0x50, 0xed, 0xa9, 0x90, 0xa3, 0x76,
+    0x22, 0x99, 0x85, 0x77, 0x93, 0x43, 0x37, 0x30, 0x5b, 0x9c, 0x95, 0xd4, 0x06, 0xd5, 0x1d, 0x32,
+    0x6f, 0x89, 0xd4, 0x86, 0x7d, 0xeb, 0x0d, 0xfa, 0x85, 0x42, 0x17, 0xbf, 0x40, 0x37, 0xd6, 0xcd,
+    0xca, 0x6f, 0x5c, 0xb3, 0xb7, 0xd6, 0xdb, 0x4b, 0xab, 0xcd, 0x0f, 0xff, 0x1e, 0xf6, 0xb5, 0xba,
+    0x4c, 0xba, 0x1e, 0x32, 0xf8, 0x2e, 0xce, 0x19, 0xf8, 0x8e, 0x7f, 0x87, 0xa8, 0xc7, 0xc5, 0x8e,
+    0xa9, 0xe2, 0x34, 0xa0, 0x91, 0xc5, 0x0d, 0x0e, 0x6f, 0x47, 0x72, 0x61, 0xb7, 0x88, 0x6c, 0x1a,
+    0x09, 0x5a, 0x72, 0xbf, 0xfe, 0x95, 0x2d, 0x0a, 0x48, 0x80, 0x9a, 0x59, 0x5d, 0x32, 0x80, 0x4b,
+    0x71, 0x96, 0xc4, 0x79, 0x16, 0x75, 0x02, 0xbd, 0x2d, 0xdb, 0xdd, 0x59, 0xc6, 0xb3, 0x6c, 0x87,
+    0x24, 0xbe, 0xab, 0xe0, 0x8f, 0x06, 0x29, 0x36, 0x66, 0xa6, 0xa5, 0x54, 0x6e, 0xa0, 0x90, 0x7f,
+    0x61, 0xa0, 0x30, 0x34, 0x34, 0x00, 0x18, 0xd3, 0x9d, 0x64, 0xf5, 0x86, 0x72, 0x58, 0x69, 0x7f,
+    0xb0, 0xd6, 0x7a, 0x70, 0x2b, 0x24, 0xa9, 0x39, 0xa5, 0xa2, 0x88, 0xe8, 0x5a, 0xe2, 0xd2, 0xa2,
+    0x32, 0x92, 0x15, 0x83, 0x38, 0xe6, 0xc1, 0x5c, 0xb2, 0x23, 0x45, 0xc6, 0x83, 0xc0, 0xde, 0x14,
+    0xad, 0xde, 0xb0, 0x44, 0x24, 0xac, 0xde, 0x67, 0x74, 0x11, 0x5c, 0x41, 0x9f, 0x07, 0xc2, 0x63,
+    0x26, 0x51, 0x01, 0x75, 0x50, 0x0b, 0x7c, 0xa1, 0xe7, 0x30, 0xac, 0x2b, 0x3c, 0x11, 0xa9, 0x7b,
+    0xde, 0x22, 0x1a, 0xab, 0xc6, 0x4e, 0xcf, 0x6e, 0xb4, 0x8f, 0x56, 0xf4, 0x72, 0x03, 0x55, 0x5e,
+    0x6f, 0x58, 0xaa, 0xa2, 0x91, 0xc8, 0x81, 0xd2, 0x33, 0x38, 0x63, 0xfa, 0x1e, 0xd6, 0xea, 0x42,
+    0xef, 0x03, 0x6a, 0x24, 0x72, 0x3e, 0xe5, 0xf7, 0x3d, 0xa2, 0x6a, 0x02, 0x7e, 0xb1, 0x6e, 0x28,
+    0x60, 0xf8, 0x0b, 0xdc, 0x18, 0x26, 0xaa, 0x94, 0x90, 0xac, 0xe4, 0x22, 0xc1, 0xe9, 0x50, 0x24,
+    0x38, 0x45, 0x90, 0x26, 0x81, 0x03, 0x5f, 0x8e, 0x03, 0x8d, 0x1e, 0x92, 0x1e, 0xd3, 0x23, 0xeb,
+    0x65, 0x49, 0x9b, 0x89, 0x85, 0xfa, 0x3d, 0x8f, 0xae, 0x9e, 0x87, 0xe7, 0x48, 0x57, 0x33, 0xb1,
+    0x57, 0x3e, 0xde, 0xb9, 0x76, 0x23, 0x6e, 0x26, 0xaa, 0x62, 0xa2, 0x3a, 0x62, 0xdc, 0xe1, 0x85,
+    0xc1, 0x43, 0x54, 0x46, 0xfa, 0x2c, 0x31, 0x2a, 0xaa, 0x3e, 0x27, 0x82, 0xc6, 0xb3, 0x33, 0x8a,
+    0x1b, 0x59, 0x2d, 0x46, 0x00, 0x62, 0x50, 0x15, 0x92, 0x7a, 0x54, 0xad, 0x3d, 0x39, 0x0f, 0x73,
+    0xc5, 0xba, 0xc7, 0x94, 0x86, 0x87, 0x7e, 0xb4, 0x8a, 0xb4, 0x77, 0x92, 0x4e, 0x74, 0x85, 0x61,
+    0x9a, 0x8a, 0x9f, 0x6a, 0x74, 0xf6, 0x8d, 0x7c, 0xde, 0xb6, 0xbe, 0xbf, 0xdf, 0xba, 0x7f, 0x75,
+    0xfb, 0xe1, 0xb5, 0xe6, 0xa9, 0x8d, 0x10, 0x77, 0x15, 0xad, 0xa2, 0x8b, 0x18, 0xff, 0xed, 0x35,
+    0x2a, 0x2c, 0xc4, 0xa3, 0xc2, 0xc5, 0x08, 0x58, 0x87, 0xc7, 0x5c, 0x8b, 0x0f, 0x31, 0x9e, 0x6f,
+    0x5b, 0x51, 0x70, 0x90, 0xed, 0x13, 0x35, 0x12, 0x5a, 0xe7, 0x79, 0x47, 0x68, 0x74, 0xa1, 0x7b,
+    0x1e, 0xc7, 0x8c, 0x35, 0x78, 0xd6, 0x76, 0x61, 0xde, 0xf1, 0xa9, 0x97, 0xec, 0xb5, 0xe5, 0xd6,
+    0xbd, 0xaf, 0x43, 0x9c, 0xd3, 0x2d, 0x09, 0x6d, 0x0c, 0x2d, 0xbb, 0xc3, 0x59, 0x1f, 0xa0, 0x03,
+    0x04, 0x6d, 0xb2, 0x89, 0xb1, 0x88, 0x36, 0x9e, 0x65, 0xf6, 0xf4, 0x58, 0x14, 0x35, 0x4d, 0x29,
+    0x23, 0xbb, 0xea, 0x12, 0x51, 0x50, 0xa6, 0x86, 0x4b, 0x0e, 0xd4, 0x7b, 0xbe, 0x6d, 0x2d, 0xd4,
+    0x49, 0x29, 0x51, 0x51, 0x54, 0x92, 0x78, 0x27, 0xa8, 0x04, 0xb1, 0xd0, 0x06, 0xa7, 0x78, 0x42,
+    0xf0, 0xa6, 0x29, 0x1a, 0xfa, 0x5c, 0x71, 0x5a, 0xd5, 0xcb, 0xef, 0x45, 0x63, 0x03, 0xb6, 0xc1,
+    0x2e, 0x91, 0x56, 0x58, 0xe0, 0x31, 0x23, 0x0b, 0x20, 0xaf, 0x1b, 0xfa, 0x8c, 0x41, 0x4c, 0x33,
+    0x90, 0x44, 0xf4, 0x0d, 0xbc, 0x10, 0x95, 0x35, 0xe3, 0x93, 0xeb, 0x39, 0xfc, 0x90, 0xba, 0xf3,
+    0xde, 0x5d, 0xf4, 0xe2, 0xb4, 0x64, 0x04, 0x48, 0xc8, 0xe7, 0xa2, 0xa1, 0x64, 0x44, 0x68, 0x4e,
+    0xe0, 0x84, 0xb3, 0x82, 0x07, 0x01, 0x1d, 0x86, 0xa3, 0x60, 0xd0, 0xec, 0x18, 0xdf, 0x9d, 0xf9,
+    0xc4, 0x5e, 0xff, 0x9c, 0x9b, 0xc5, 0xa9, 0xaa, 0x54, 0x37, 0x89, 0xe8, 0x95, 0x62, 0x1e, 0xd7,
+    0x37, 0x71, 0xb3, 0xcc, 0x45, 0x0e, 0x46, 0x07, 0x40, 0x5c, 0x49, 0xe2, 0xbc, 0xed, 0xb2, 0x3c,
+    0x63, 0x56, 0xf5, 0xb9, 0x20, 0x0c, 0x47, 0x75, 0x02, 0x4b, 0x24, 0xc3, 0xa0, 0x53, 0x82, 0x2c,
+    0xf3, 0xce, 0x12, 0x60, 0x5b, 0xc1, 0x8c, 0x4f, 0xcf, 0xe8, 0x75, 0xa2, 0x85, 0xcf, 0x1c, 0x03,
+    0xec, 0xc4, 0x22, 0xa9, 0xfc, 0x48, 0x4e, 0x26, 0x33, 0x1d, 0x8f, 0x1d, 0xfb, 0xde, 0x5f, 0xda,
+    0x7f, 0xba, 0x61, 0x6f, 0x6c, 0xed, 0xac, 0x7c, 0x13, 0xe2, 0xb4, 0x26, 0xcd, 0x86, 0x32, 0x90,
+    0x8a, 0x32, 0x4f, 0xa8, 0x72, 0xb1, 0x73, 0x25, 0xe7, 0x66, 0x22, 0xf0, 0x60, 0x30, 0x75, 0xc8,
+    0x15, 0x7b, 0x95, 0x20, 0x1c, 0x1e, 0x75, 0x0a, 0x98, 0x22, 0x92, 0xf3, 0xac, 0x29, 0x66, 0xba,
+    0x48, 0x9c, 0xeb, 0x5f, 0xbd, 0x18, 0x8d, 0xe7, 0x83, 0x82, 0x20, 0xba, 0x47, 0xd6, 0xf9, 0x5e,
+    0x26, 0xe8, 0xa2, 0xf4, 0x43, 0xe8, 0x9e, 0x8e, 0x8a, 0x2e, 0x29, 0xc7, 0xfc, 0x5e, 0x8e, 0x53,
+    0x4e, 0xe9, 0xe2, 0x7f, 0xdb, 0xd7, 0x7e, 0x04, 0x43, 0xb0, 0x57, 0x96, 0x9b, 0x6b, 0x5f, 0x84,
+    0x24, 0x54, 0x97, 0x66, 0x48, 0x5c, 0x1b, 0x9d, 0x2d, 0x7b, 0x90, 0x59, 0x7a, 0xb8, 0x18, 0x5e,
+    0xe6, 0x6f, 0xa2, 0xb3, 0x1e, 0x86, 0xec, 0xf1, 0xce, 0x0a, 0x1c, 0x9d, 0xcd, 0xf5, 0xf3, 0xad,
+    0xeb, 0xe1, 0xda, 0x96, 0xa5, 0x4b, 0x34, 0x34, 0x89, 0xe9, 0x09, 0x95, 0x34, 0xcb, 0x3f, 0x99,
+    0x9e, 0x0c, 0x79, 0x5e, 0x80, 0xa9, 0x27, 0x7d, 0xc4, 0xb3, 0xf5, 0xcd, 0x94, 0x08, 0xdf, 0xd2,
+    0xc5, 0xc7, 0xa8, 0x5f, 0x75, 0x8e, 0x5e, 0xc3, 0x2e, 0xd6, 0xab, 0x81, 0x16, 0xf0, 0xa0, 0xe1,
+    0xfa, 0xbb, 0xb1, 0xac, 0x53, 0x2e, 0x1f, 0xcb, 0xb2, 0x92, 0xfe, 0x18, 0x96, 0xa6, 0x9d, 0x4a,
+    0xfa, 0xd3, 0xa2, 0x18, 0xab, 0x0f, 0x8b, 0xa2, 0xf3, 0x51, 0x56, 0x66, 0x85, 0xb2, 0x2a, 0x99,
+    0x66, 0x29, 0xc1, 0x9c, 0x53, 0xc2, 0xaf, 0xb9, 0x07, 0x3f, 0x62, 0xe9, 0x34, 0x31, 0xfe, 0xef,
+    0xab, 0xd7, 0x2f, 0x0a, 0x63, 0x58, 0x41, 0x75, 0x2a, 0xf6, 0xf4, 0x71, 0x2c, 0x0b, 0x13, 0xf9,
+    0xcb, 0x02, 0x45, 0xd4, 0x00, 0xe0, 0xe8, 0x2c, 0xf8, 0x9c, 0x10, 0x14, 0x99, 0x3e, 0xbc, 0x01,
+    0x81, 0x53, 0x42, 0xa0, 0x25, 0xb9, 0x52, 0x02, 0xc3, 0xcb, 0x44, 0x14, 0x7e, 0xb7, 0xd5, 0x93,
+    0x56, 0x6d, 0xb0, 0xe0, 0x2d, 0x9f, 0x9c, 0x3a, 0x06, 0x6f, 0x31, 0xfa, 0xfc, 0xd7, 0xc0, 0xa3,
+    0xcf, 0x2b, 0xa7, 0x18, 0x77, 0xed, 0x47, 0x2e, 0x97, 0xa8, 0xfe, 0x32, 0x45, 0x64, 0x58, 0x71,
+    0xe0, 0x20, 0x2b, 0xd3, 0x75, 0xe0, 0x1d, 0x96, 0x52, 0xa3, 0xbb, 0xa7, 0x88, 0x2e, 0xfe, 0x64,
+    0x9f, 0xbf, 0xc0, 0xd0, 0x79, 0xb8, 0x78, 0x00, 0x50, 0xa3, 0x22, 0x00, 0x78, 0x53, 0x58, 0x21,
+    0x33, 0x31, 0xfe, 0xcb, 0xb7, 0xa7, 0x77, 0x37, 0xd7, 0x85, 0x9d, 0x87, 0xe7, 0xed, 0x33, 0x37,
+    0x18, 0x78, 0x0e, 0x0b, 0x63, 0x10, 0x9c, 0x52, 0x23, 0x07, 0x51, 0x6c, 0xaa, 0x5b, 0x1d, 0xa4,
+    0xb5, 0x2e, 0xae, 0x80, 0xbc, 0x65, 0xd3, 0x0d, 0xb0, 0x68, 0x2d, 0xba, 0x32, 0x21, 0x00, 0x36,
+    0xac, 0x26, 0x81, 0x82, 0x18, 0x16, 0x8c, 0xd7, 0xe4, 0x54, 0xf2, 0x70, 0x32, 0x8d, 0xe3, 0x35,
+    0xbd, 0x61, 0x12, 0x59, 0x9f, 0xd3, 0x02, 0xc3, 0xe3, 0xbf, 0x9c, 0xbe, 0x30, 0x96, 0x65, 0xb0,
+    0xfe, 0x6b, 0xf4, 0x1d, 0xe5, 0xd3, 0x77, 0x94, 0xd1, 0x77, 0xbe, 0x07, 0x7d, 0x7c, 0x44, 0x02,
+    0xd6, 0x1a, 0xb9, 0xd8, 0x26, 0xf9, 0xd8, 0x26, 0x29, 0xb6, 0x8b, 0x9f, 0x3f, 0x12, 0x36, 0x2e,
+    0xa2, 0x13, 0x7c, 0x44, 0x27, 0xd8, 0xb6, 0xfe, 0xf7, 0xbf, 0xce, 0xf6, 0x03, 0x7c, 0xfa, 0x0e,
+    0x30, 0xfa, 0x3e, 0x7a, 0xe2, 0xf4, 0xf1, 0xdc, 0x4d, 0x7c, 0x88, 0x63, 0xce, 0xb4, 0x8c, 0xbb,
+    0xbb, 0xb5, 0xb2, 0xf3, 0xf0, 0xb3, 0xd6, 0xfd, 0x9b, 0xed, 0xa5, 0xab, 0xf6, 0xbd, 0xaf, 0x98,
+    0xf9, 0xed, 0x6e, 0xad, 0x3e, 0x49, 0x03, 0xff, 0xf7, 0xd5, 0xbf, 0xfc, 0x84, 0x16, 0xce, 0x30,
+    0xf6, 0x61, 0xdb, 0x6e, 0x39, 0x99, 0x79, 0x2c, 0xef, 0x6d, 0x3c, 0x38, 0x07, 0xab, 0xb7, 0xec,
+    0x3b, 0x7d, 0x72, 0xb8, 0xd3, 0x1f, 0x70, 0x96, 0xae, 0x79, 0xd0, 0x5f, 0xa7, 0x6f, 0xe3, 0xcd,
+    0x2b, 0x3f, 0xdb, 0x5b, 0x4b, 0xf6, 0xda, 0xf7, 0xf6, 0xa9, 0xcb, 0x8f, 0xcc, 0xd4, 0x60, 0xcd,
+    0xf4, 0x89, 0xb2, 0xf0, 0xdc, 0x06, 0x7a, 0xc8, 0x9d, 0x6b, 0x67, 0x19, 0x8a, 0x3e, 0x36, 0x4a,
+    0xcb, 0xb4, 0x89, 0xbe, 0x14, 0xda, 0x2b, 0xca, 0xba, 0x27, 0x85, 0x2c, 0x41, 0xfe, 0x87, 0xa3,
+    0xa5, 0x84, 0x22, 0x03, 0x01, 0xa0, 0xd0, 0x65, 0x15, 0x64, 0x00, 0x47, 0x24, 0xb1, 0x8e, 0xc1,
+    0x78, 0x2a, 0x89, 0xe3, 0xa8, 0xd3, 0xad, 0xbf, 0xdf, 0x6b, 0x7f, 0xfc, 0xcf, 0x3d, 0xd9, 0xb7,
+    0x8b, 0x2e, 0x84, 0xa7, 0x26, 0x69, 0x0d, 0x49, 0xe5, 0x61, 0x62, 0x5f, 0x10, 0x57, 0x73, 0xf5,
+    0x43, 0x38, 0x23, 0x1e, 0x1f, 0x57, 0x5d, 0xa2, 0xe7, 0x1f, 0x07, 0x17, 0xfb, 0x82, 0xb8, 0xec,
+    0xbb, 0xd7, 0xda, 0x4b, 0xf7, 0x1f, 0x1f, 0x57, 0x05, 0x92, 0x13, 0x7d, 0x8e, 0x87, 0x8b, 0x7d,
+    0x41, 0x5c, 0x3b, 0x77, 0xaf, 0xb6, 0x2f, 0xad, 0x77, 0xc6, 0xf5, 0xa8, 0xea, 0xb8, 0xb3, 0x71,
+    0xb3, 0x7d, 0xf5, 0x7b, 0xfb, 0xc2, 0x83, 0xed, 0xfb, 0xd7, 0x9f, 0xb0, 0x3a, 0x5e, 0x0f, 0x01,
+    0xef, 0x43, 0x1d, 0x03, 0x45, 0xd5, 0x4e, 0x4a, 0x49, 0xa7, 0x08, 0xac, 0x5a, 0x80, 0x99, 0x06,
+    0xb3, 0xd0, 0x59, 0x5d, 0x29, 0x93, 0x23, 0xf8, 0x29, 0x21, 0x40, 0x2c, 0x59, 0x26, 0x55, 0x5d,
+    0x85, 0xc8, 0xaf, 0x94, 0xd8, 0xf9, 0xf9, 0x23, 0xfb, 0x83, 0x2f, 0x19, 0x01, 0xbb, 0x5b, 0x67,
+    0xed, 0xaf, 0xfe, 0xb8, 0xbb, 0x75, 0xc9, 0x5e, 0x5d, 0xdb, 0x79, 0xf8, 0xe9, 0xbf, 0x96, 0x4e,
+    0x31, 0xf9, 0x65, 0x32, 0x99, 0xfe, 0x4c, 0x00, 0xb5, 0x3f, 0x50, 0x26, 0x0d, 0xc9, 0x4b, 0x93,
+    0x5f, 0x47, 0x1a, 0x52, 0xa8, 0x15, 0xeb, 0x17, 0xda, 0x4b, 0xa7, 0x1e, 0x47, 0x52, 0xbd, 0xe2,
+    0xb9, 0x9d, 0x5b, 0x3f, 0xb7, 0x1e, 0xdc, 0xea, 0x16, 0xcf, 0xf9, 0x81, 0xdc, 0x24, 0xb1, 0x2c,
+    0x88, 0xc9, 0xcd, 0x3d, 0x46, 0x72, 0x81, 0xdb, 0x82, 0xc7, 0x55, 0x8a, 0x70, 0xa9, 0x20, 0xc0,
+    0x35, 0x4b, 0x9f, 0x99, 0x51, 0x21, 0xd2, 0x64, 0xdf, 0x53, 0x49, 0xac, 0x30, 0x4e, 0xb2, 0x5a,
+    0x16, 0x6a, 0x7c, 0xef, 0xd3, 0xcf, 0x57, 0x37, 0x81, 0x66, 0x0b, 0xb8, 0x1d, 0x5a, 0x65, 0xca,
+    0xa1, 0xfe, 0x7d, 0x74, 0x27, 0xb0, 0x8b, 0x6e, 0x27, 0x37, 0xed, 0x9f, 0x70, 0x60, 0xd2, 0x2c,
+    0x9e, 0x71, 0x8f, 0x3e, 0xd2, 0xe0, 0x1d, 0xa2, 0x93, 0x2d, 0x27, 0x33, 0xe8, 0x47, 0x9a, 0x1d,
+    0x39, 0xe0, 0x96, 0x2e, 0xb0, 0xf6, 0xc0, 0x70, 0x04, 0xb6, 0xbc, 0x37, 0x1d, 0xf4, 0xea, 0xea,
+    0xde, 0xd6, 0x59, 0x91, 0x87, 0xd6, 0x82, 0xc2, 0x49, 0x2d, 0x26, 0x63, 0x41, 0x5d, 0x2d, 0x4b,
+    0x1a, 0xee, 0x2a, 0x45, 0x9d, 0xe5, 0x3f, 0x9a, 0xeb, 0xeb, 0xad, 0x07, 0x17, 0x5a, 0xf7, 0x2f,
+    0xf7, 0x1f, 0x75, 0x78, 0xb5, 0x70, 0x7f, 0x0f, 0x47, 0xf1, 0xad, 0x6b, 0x78, 0x14, 0x5d, 0x8f,
+    0xd9, 0x67, 0x87, 0x2d, 0x77, 0x31, 0x74, 0xd3, 0x54, 0x64, 0x9e, 0x9d, 0xd3, 0xaa, 0xfd, 0xf9,
+    0xb5, 0xd6, 0xd7, 0xb7, 0xfb, 0x85, 0x59, 0x07, 0x52, 0xe6, 0x20, 0x37, 0x75, 0x2d, 0xc5, 0x34,
+    0x3b, 0xc2, 0xdd, 0x38, 0xdd, 0xfa, 0xfc, 0x54, 0x37, 0xb8, 0xb8, 0x37, 0x47, 0x0a, 0x6e, 0x32,
+    0x4b, 0x4b, 0x27, 0x58, 0x94, 0x86, 0x84, 0xb7, 0xcb, 0xd2, 0x7e, 0xbc, 0x8c, 0x03, 0x99, 0x16,
+    0x58, 0xf2, 0x41, 0x41, 0x4a, 0xb3, 0xc4, 0x15, 0xe4, 0xf6, 0xc3, 0x2b, 0xf6, 0xcd, 0x4f, 0xec,
+    0x9f, 0xee, 0x40, 0xa4, 0xd6, 0x3c, 0xf7, 0x65, 0x77, 0x59, 0xf6, 0x40, 0xcc, 0xae, 0x5c, 0x02,
+    0x88, 0xca, 0x2a, 0x91, 0x0c, 0x4f, 0x65, 0x36, 0x3f, 0x68, 0xff, 0xf5, 0x7a, 0x6f, 0x04, 0xdd,
+    0x74, 0xe1, 0xc9, 0x46, 0xa9, 0x7e, 0x61, 0xfc, 0x3f, 0xe6, 0xa9, 0x74, 0x4b, 0x7a, 0x62, 0x8e,
+    0xca, 0xc9, 0x6d, 0xed, 0x4f, 0xef, 0x6d, 0xdf, 0xbf, 0xc3, 0x36, 0xf2, 0xa8, 0xce, 0xea, 0xb8,
+    0x25, 0xfd, 0x8a, 0xbe, 0xca, 0xdf, 0x74, 0x1f, 0x5b, 0x0e, 0xdc, 0x4b, 0xf4, 0xb2, 0x1c, 0x67,
+    0x85, 0x73, 0x39, 0xc1, 0x70, 0x55, 0xe6, 0x5e, 0x77, 0x5e, 0xc7, 0x45, 0xb1, 0x0b, 0x3b, 0xb8,
+    0x68, 0x69, 0x85, 0xc6, 0xa7, 0x99, 0xbd, 0x8e, 0xdb, 0x0f, 0x3e, 0x82, 0x83, 0xbf, 0xb5, 0xba,
+    0xd2, 0xbc, 0xfc, 0x6d, 0x2f, 0x88, 0xec, 0x7e, 0xc1, 0x81, 0xe9, 0xdf, 0x38, 0xf4, 0x30, 0x64,
+    0x16, 0xd3, 0x33, 0x41, 0x36, 0x2f, 0x2e, 0xc3, 0xdf, 0xdd, 0xcd, 0x2f, 0xe8, 0x8e, 0xe8, 0xcd,
+    0x87, 0xb3, 0xf5, 0xc3, 0xf4, 0x19, 0x2b, 0x99, 0x75, 0xc8, 0x18, 0x33, 0xd3, 0x0a, 0xcd, 0x22,
+    0xcb, 0x55, 0xb4, 0xcb, 0x52, 0xa2, 0x51, 0x57, 0x75, 0x49, 0x3e, 0xac, 0x18, 0xb5, 0x39, 0xc9,
+    0xa0, 0x01, 0x47, 0x17, 0x1b, 0xa4, 0x64, 0xf7, 0xc7, 0x3a, 0xf7, 0x72, 0xc1, 0x63, 0xdc, 0x84,
+    0x3b, 0xd0, 0xc3, 0x8b, 0x70, 0x60, 0xe0, 0x05, 0x85, 0x07, 0xe7, 0x00, 0x3c, 0x8f, 0xf7, 0xe2,
+    0xf8, 0x7f, 0xcc, 0x5b, 0x84, 0xee, 0x20, 0x9f, 0x64, 0x89, 0xea, 0xcf, 0x34, 0x81, 0x0d, 0x82,
+    0xef, 0x2b, 0xe2, 0x75, 0x2e, 0x3e, 0xfb, 0x30, 0x29, 0xef, 0x36, 0x33, 0x9c, 0xe5, 0xfa, 0xb7,
+    0x92, 0x90, 0x24, 0x9c, 0xd9, 0x68, 0xad, 0x2e, 0x3b, 0x79, 0x6e, 0x74, 0x4e, 0x20, 0xa3, 0xc5,
+    0xf7, 0x83, 0x55, 0xa5, 0xee, 0x5b, 0x57, 0x9f, 0x47, 0x77, 0x1f, 0x34, 0x60, 0xf3, 0xe5, 0xcd,
+    0x4f, 0xfa, 0xa3, 0xe1, 0x15, 0x22, 0xfd, 0x2a, 0x34, 0xbc, 0x34, 0x21, 0x1c, 0x99, 0xe8, 0x8f,
+    0x84, 0x97, 0xea, 0x47, 0x7e, 0x1d, 0x36, 0x7c, 0xb7, 0x64, 0x5f, 0xbd, 0x0a, 0xa1, 0x55, 0xbf,
+    0x84, 0x80, 0x9f, 0xfa, 0x75, 0x28, 0x71, 0x6a, 0x02, 0x1f, 0xdf, 0x69, 0x7f, 0xfc, 0x43, 0x7f,
+    0xa4, 0xbc, 0x56, 0xb7, 0x94, 0x1a, 0xf9, 0x55, 0x68, 0xb9, 0x7b, 0xa5, 0xf5, 0xd5, 0xfd, 0xfe,
+    0xa8, 0x78, 0x99, 0xc6, 0x94, 0x3d, 0x68, 0x78, 0xfc, 0x64, 0x2a, 0x74, 0xf3, 0xc6, 0xcb, 0xa7,
+    0x34, 0x69, 0xb6, 0x43, 0xf2, 0xe4, 0x5d, 0x7f, 0xb9, 0x35, 0x11, 0x3f, 0x36, 0x83, 0x53, 0x73,
+    0x02, 0xb2, 0x2f, 0xac, 0x16, 0x78, 0xc5, 0xf4, 0x58, 0xac, 0x10, 0x83, 0x55, 0xc6, 0x03, 0x0f,
+    0x32, 0x67, 0x27, 0x5d, 0x61, 0xa5, 0xb6, 0xa7, 0x3a, 0x6d, 0x8c, 0x43, 0x49, 0x47, 0x12, 0xdc,
+    0x34, 0xb0, 0x4f, 0x1a, 0x7e, 0xb9, 0xf4, 0x57, 0xf0, 0x66, 0x0c, 0x21, 0xcb, 0x36, 0xfb, 0xbf,
+    0x6c, 0x08, 0xde, 0x51, 0xf1, 0xf8, 0x49, 0xef, 0xaa, 0x98, 0x98, 0xd9, 0xe3, 0x78, 0x0c, 0x8e,
+    0x59, 0x36, 0x94, 0xba, 0xe5, 0x13, 0x9a, 0xcd, 0x86, 0xae, 0xdf, 0xbc, 0xf1, 0x4a, 0x43, 0x63,
+    0xad, 0x0f, 0xde, 0x66, 0x15, 0x39, 0x2d, 0x9c, 0x0c, 0x6d, 0x50, 0xd6, 0xcb, 0x8d, 0x1a, 0xde,
+    0xf8, 0xfe, 0xa1, 0x41, 0x8c, 0x85, 0x49, 0xda, 0x53, 0xa6, 0x1b, 0x2f, 0xa9, 0x6a, 0x2a, 0x49,
+    0xef, 0xe0, 0x92, 0xe9, 0x0c, 0xe4, 0x22, 0x87, 0xa4, 0x72, 0x35, 0x55, 0x17, 0x4a, 0xe3, 0x42,
+    0x3d, 0x43, 0xe9, 0xc4, 0x8c, 0x26, 0x63, 0x90, 0x9a, 0x3e, 0x0b, 0x1c, 0x64, 0xf2, 0x4d, 0xa6,
+    0xd3, 0xc5, 0xbe, 0x41, 0xbb, 0x12, 0x09, 0x80, 0xd7, 0x10, 0xbc, 0xf6, 0x08, 0xe0, 0x67, 0x88,
+    0x75, 0x48, 0x25, 0xf8, 0x78, 0x60, 0xe1, 0x88, 0x8c, 0x7b, 0x0c, 0x00, 0x91, 0x64, 0xd9, 0x87,
+    0x10, 0x06, 0x40, 0xfb, 0x43, 0x33, 0xe5, 0x86, 0x81, 0x1d, 0x8d, 0x53, 0x10, 0x71, 0x12, 0xab,
+    0xf7, 0x42, 0xde, 0xcd, 0x63, 0x36, 0xd4, 0x09, 0x10, 0x67, 0x7f, 0x24, 0x3e, 0x8e, 0x0b, 0x01,
+    0x94, 0xca, 0xb4, 0x04, 0x88, 0xa9, 0x4a, 0xdd, 0x76, 0x15, 0xa1, 0x5e, 0x0d, 0x10, 0xcb, 0x30,
+    0xa4, 0x92, 0x28, 0xe8, 0x3e, 0xa8, 0x0d, 0xe8, 0x20, 0x8f, 0x5a, 0xd0, 0xba, 0x54, 0xcd, 0x9c,
+    0xe1, 0x53, 0x69, 0x75, 0x21, 0x32, 0x49, 0xd7, 0x46, 0xf9, 0x6c, 0x65, 0x14, 0x4d, 0x23, 0xc6,
+    0x14, 0xa4, 0xa9, 0xb0, 0x16, 0x00, 0x47, 0x3f, 0xd3, 0xa0, 0x3f, 0xe3, 0xe4, 0x86, 0x30, 0x25,
+    0x49, 0x6f, 0x79, 0x93, 0xe1, 0x69, 0x26, 0xb1, 0xa6, 0xc0, 0xed, 0xea, 0x0d, 0x2b, 0x95, 0x4a,
+    0xa3, 0xaa, 0x70, 0xd6, 0xe1, 0x15, 0x69, 0x72, 0x00, 0xef, 0x4d, 0x73, 0x3d, 0x99, 0xd0, 0x3e,
+    0xf5, 0x65, 0xf3, 0xc7, 0x0f, 0x9b, 0xe7, 0x6e, 0xb4, 0x97, 0x4e, 0xed, 0x6e, 0xad, 0xbc, 0x41,
+    0xa6, 0x27, 0x01, 0x29, 0xb1, 0x84, 0xd6, 0x3f, 0x36, 0xec, 0xf5, 0xbf, 0x09, 0x23, 0xf9, 0xdd,
+    0xad, 0xd5, 0xdd, 0xad, 0xb3, 0xcd, 0x8b, 0x37, 0xed, 0xad, 0x25, 0x38, 0x1f, 0xec, 0x4f, 0x3f,
+    0x6b, 0x2f, 0x2d, 0xd9, 0x2b, 0xb7, 0x85, 0xac, 0xd3, 0xd7, 0xb3, 0xf3, 0xe0, 0xd6, 0xce, 0x86,
+    0x6f, 0x6e, 0x2a, 0x2c, 0x9e, 0x33, 0x81, 0x0e, 0xad, 0xa1, 0xaa, 0xc5, 0x38, 0x63, 0xe7, 0xcc,
+    0x13, 0x90, 0x39, 0x2d, 0xa4, 0xa2, 0x7c, 0x35, 0x88, 0xd5, 0x30, 0xf0, 0xb3, 0xf0, 0xec, 0xb3,
+    0xf0, 0x37, 0xe8, 0x3d, 0xcc, 0xc2, 0xb8, 0x9c, 0x08, 0xa5, 0x52, 0x49, 0xf0, 0x28, 0xcb, 0x1c,
+    0x9f, 0x38, 0xf4, 0x2a, 0x6f, 0x5b, 0x1e, 0x06, 0x90, 0x90, 0x06, 0x46, 0xf6, 0x86, 0x19, 0xc3,
+    0xc1, 0xe8, 0x22, 0x73, 0x3e, 0xb4, 0x54, 0x72, 0xce, 0x1c, 0xcd, 0x66, 0x93, 0xc2, 0xf3, 0x02,
+    0x70, 0x5b, 0xc2, 0xf5, 0x99, 0xaa, 0x6e, 0x5a, 0xf8, 0xbb, 0x2f, 0x18, 0x4b, 0x8e, 0x8e, 0xe4,
+    0xb3, 0x73, 0x66, 0x54, 0x96, 0x40, 0x9e, 0xae, 0xd5, 0x20, 0x86, 0xc5, 0x5b, 0xd1, 0x92, 0x40,
+    0x50, 0x10, 0x27, 0x63, 0xc7, 0x0e, 0xd3, 0x14, 0x19, 0x26, 0xfc, 0x76, 0xf2, 0xf8, 0xab, 0xe0,
+    0x47, 0x0c, 0x50, 0x7b, 0x90, 0x94, 0x64, 0x49, 0x11, 0x78, 0xb4, 0xc5, 0xa9, 0x22, 0xa4, 0xe4,
+    0x4c, 0xb9, 0x06, 0x66, 0xc1, 0x74, 0x8f, 0xbd, 0x14, 0x41, 0xc5, 0x4d, 0x22, 0xe0, 0xcf, 0xab,
+    0x16, 0x58, 0x96, 0x92, 0x8a, 0xda, 0xc0, 0x22, 0x87, 0xb8, 0xb2, 0xaa, 0x9b, 0x48, 0x1a, 0x53,
+    0x92, 0x93, 0x01, 0x89, 0x04, 0x55, 0xc8, 0xe3, 0xd4, 0x80, 0x30, 0x48, 0xb5, 0x25, 0x08, 0x8b,
+    0xaf, 0x30, 0xf6, 0xfa, 0x37, 0xcd, 0x4f, 0x7f, 0x68, 0x5e, 0xbc, 0xcd, 0xcc, 0x67, 0x7b, 0xf3,
+    0xa6, 0xbd, 0x7c, 0xaf, 0x75, 0xee, 0x76, 0xeb, 0xd2, 0x9f, 0xed, 0x9b, 0x1f, 0x37, 0x6f, 0xfd,
+    0x08, 0x5a, 0xc4, 0xd4, 0x09, 0x46, 0x9a, 0x9f, 0x6c, 0xd8, 0x5f, 0x7c, 0xd6, 0x5e, 0x5e, 0x07,
+    0x25, 0x8a, 0xcb, 0x29, 0xbc, 0xa7, 0x08, 0x03, 0x91, 0x1d, 0x49, 0x13, 0xef, 0xb5, 0x93, 0x82,
+    0xa2, 0x09, 0xf0, 0xbd, 0xa3, 0xb9, 0xb9, 0x17, 0xe0, 0x49, 0xc7, 0xe3, 0xbd, 0x8a, 0xb2, 0x03,
+    0x3b, 0xc0, 0x1f, 0x26, 0xa1, 0x60, 0x81, 0x93, 0x14, 0x90, 0xf0, 0xa2, 0x90, 0x84, 0x64, 0x5c,
+    0x18, 0x15, 0x92, 0x51, 0x81, 0x52, 0x6c, 0x60, 0x42, 0x96, 0xa4, 0x95, 0x49, 0x4f, 0x84, 0x6e,
+    0xe0, 0x01, 0x08, 0x83, 0x36, 0x2d, 0x67, 0x5c, 0x08, 0xa8, 0x39, 0xe5, 0x5a, 0x92, 0x83, 0x03,
+    0x6b, 0xf9, 0x2e, 0x7c, 0x48, 0xef, 0xdf, 0xa3, 0x15, 0x7c, 0x99, 0xf6, 0x7c, 0x77, 0xb7, 0x55,
+    0x8f, 0x6b, 0xde, 0xaa, 0xda, 0x5e, 0x0e, 0x31, 0xf7, 0x4a, 0x21, 0x70, 0xd2, 0x4c, 0xa3, 0x66,
+    0x4c, 0xf7, 0x7f, 0xd2, 0x30, 0x75, 0x46, 0x40, 0x07, 0x2c, 0x2d, 0xe8, 0xfe, 0x42, 0xe8, 0x52,
+    0xc9, 0xb7, 0x03, 0x97, 0x16, 0xc9, 0xe7, 0x6b, 0xcf, 0x27, 0x13, 0xef, 0xf0, 0xd8, 0xed, 0x00,
+    0x4a, 0xbb, 0x10, 0x1f, 0xf5, 0xd0, 0x61, 0xf7, 0xfd, 0xac, 0x7a, 0xcf, 0xf1, 0x05, 0x35, 0x39,
+    0x55, 0xe6, 0xe9, 0x96, 0xe7, 0x86, 0xd2, 0xd4, 0x3a, 0x32, 0x58, 0x9d, 0x87, 0x99, 0x45, 0xc7,
+    0x0f, 0x05, 0x9b, 0x6b, 0x28, 0x40, 0x62, 0x01, 0xcb, 0x92, 0x59, 0x80, 0xf7, 0x62, 0xb9, 0x84,
+    0x5a, 0x55, 0x4e, 0x67, 0xac, 0x2a, 0xd1, 0x52, 0x06, 0xb2, 0xd1, 0xc8, 0x60, 0xf9, 0x11, 0x80,
+    0xb1, 0x31, 0x8b, 0x7a, 0x66, 0x6a, 0xc5, 0x56, 0xba, 0xf7, 0x41, 0xe4, 0xdc, 0xa0, 0x5e, 0x6a,
+    0x9e, 0x5d, 0xdd, 0x7e, 0xb0, 0xde, 0xbc, 0x7c, 0x15, 0x82, 0xf0, 0xed, 0xfb, 0x5f, 0x0a, 0x85,
+    0xa1, 0x57, 0xde, 0x17, 0xd8, 0xb5, 0x2a, 0xbb, 0x2f, 0xd8, 0xde, 0xbc, 0x0e, 0xde, 0x96, 0x5d,
+    0xb1, 0x0a, 0xaf, 0x0f, 0x8c, 0xd9, 0x77, 0xbf, 0x1a, 0x87, 0xbf, 0xd7, 0xbf, 0x1f, 0x47, 0x17,
+    0xcd, 0xee, 0x1d, 0xd7, 0x2f, 0x08, 0x93, 0xbb, 0x5b, 0x9f, 0x86, 0x58, 0x74, 0xeb, 0x67, 0xfb,
+    0xd6, 0x25, 0x7b, 0x69, 0xcb, 0x3e, 0x75, 0x19, 0xbe, 0xef, 0xdc, 0xf9, 0x60, 0xe7, 0xe1, 0x32,
+    0x5a, 0x7c, 0xcd, 0x44, 0x6b, 0xbd, 0x78, 0xb3, 0x75, 0xef, 0x21, 0xde, 0x74, 0xac, 0x2c, 0xdb,
+    0xe7, 0xcf, 0xd9, 0xeb, 0xb7, 0xc1, 0x5a, 0x69, 0x0f, 0x89, 0xb0, 0xb3, 0xfc, 0x0d, 0x64, 0x05,
+    0xb0, 0x6a, 0xe7, 0xc1, 0x57, 0x4f, 0x85, 0xf5, 0xe0, 0xb7, 0xc7, 0xdf, 0xfa, 0xfd, 0xc4, 0xa1,
+    0x13, 0x47, 0x8e, 0xbf, 0xfc, 0xfb, 0x63, 0x93, 0xa0, 0x0d, 0xfb, 0x72, 0xc5, 0xd0, 0x11, 0xf0,
+    0xae, 0xbe, 0xf0, 0x12, 0xeb, 0x5b, 0x2a, 0x09, 0x15, 0x09, 0x5c, 0xd8, 0x00, 0x0e, 0x1d, 0x25,
+    0x15, 0xb4, 0x94, 0x1c, 0x7d, 0x39, 0x81, 0xad, 0x68, 0xde, 0x1b, 0xfa, 0x24, 0xc3, 0x71, 0x52,
+    0x74, 0xe0, 0x40, 0xc3, 0x5c, 0x70, 0x17, 0x73, 0xce, 0x11, 0x98, 0x31, 0x89, 0x32, 0xeb, 0x5b,
+    0xb8, 0xc9, 0xd7, 0x07, 0x50, 0x6e, 0x2e, 0x15, 0x60, 0xa2, 0xee, 0x3b, 0x25, 0xa4, 0xa3, 0xe8,
+    0x11, 0xa0, 0x43, 0x4e, 0xda, 0x9b, 0x12, 0xf8, 0x03, 0x0c, 0x7e, 0x65, 0x6a, 0x6a, 0x42, 0x60,
+    0x27, 0x23, 0x88, 0x71, 0x7b, 0xf3, 0xcc, 0xf6, 0xe6, 0xd2, 0xf6, 0xe6, 0x37, 0x3b, 0x1b, 0x77,
+    0x9b, 0xdf, 0xfd, 0x71, 0xe7, 0xe1, 0xff, 0xc1, 0x27, 0x7b, 0x75, 0x6d, 0x7b, 0x73, 0xcd, 0x3e,
+    0xbd, 0x06, 0x02, 0x08, 0x81, 0xf7, 0x77, 0x6a, 0x19, 0x0d, 0x52, 0xe4, 0x6a, 0xdd, 0x2c, 0x51,
+    0x5f, 0x54, 0x4b, 0x11, 0xea, 0x9f, 0x35, 0x4a, 0x21, 0xfa, 0x33, 0x70, 0x7c, 0xc1, 0x6c, 0xc7,
+    0xe3, 0x2f, 0x82, 0xa1, 0x2b, 0x9a, 0xa4, 0xaa, 0x0b, 0xce, 0x48, 0x84, 0xa3, 0xe9, 0xae, 0x47,
+    0x28, 0x4c, 0x3e, 0x86, 0xbe, 0x80, 0xf0, 0xa3, 0x9f, 0xba, 0x24, 0x77, 0x8b, 0x7f, 0xdc, 0x9b,
+    0x76, 0x70, 0x36, 0xf0, 0xe9, 0x00, 0x76, 0x89, 0x41, 0x5a, 0x71, 0x50, 0x55, 0x60, 0xc6, 0x09,
+    0xf0, 0x12, 0x29, 0xae, 0x67, 0x41, 0xe1, 0x03, 0xe0, 0x0c, 0xeb, 0x38, 0xcd, 0x0a, 0x85, 0xf0,
+    0x24, 0x54, 0xaa, 0x79, 0x3c, 0xd1, 0x08, 0x78, 0x0a, 0x84, 0xf4, 0xa6, 0x20, 0xd2, 0xf9, 0xd8,
+    0xb2, 0x06, 0x8f, 0x46, 0x1a, 0xd6, 0x18, 0x03, 0x02, 0xee, 0x30, 0x85, 0xe3, 0xf8, 0x6b, 0xb6,
+    0xe7, 0x01, 0xaa, 0x28, 0xb8, 0x2b, 0xde, 0xa2, 0x53, 0x78, 0xb8, 0x55, 0x82, 0x1e, 0xed, 0x98,
+    0x64, 0x55, 0x33, 0xd5, 0x85, 0xba, 0x6e, 0xa5, 0xe6, 0x01, 0x10, 0xc7, 0x69, 0xe1, 0xbc, 0x71,
+    0x21, 0x8f, 0x6a, 0x35, 0x2f, 0x64, 0x4b, 0xb8, 0xae, 0x08, 0x18, 0xdd, 0xa7, 0xc5, 0xbe, 0x42,
+    0xf3, 0x24, 0x76, 0x1a, 0x00, 0x6f, 0x58, 0xe0, 0xe6, 0x77, 0x8b, 0xc2, 0x91, 0xe5, 0x35, 0xda,
+    0xa5, 0x50, 0xb4, 0xf3, 0xc2, 0x73, 0x42, 0x0a, 0x37, 0x30, 0x98, 0x4b, 0xa3, 0xc4, 0xeb, 0xf3,
+    0x54, 0x63, 0xc5, 0x85, 0xd8, 0x78, 0x3a, 0x72, 0xd6, 0xe0, 0x41, 0xbd, 0xba, 0x06, 0xd6, 0x0c,
+    0x9f, 0x77, 0x1e, 0x7c, 0x8b, 0xfd, 0x56, 0x77, 0xef, 0xda, 0xe7, 0x57, 0x9a, 0x2b, 0xe7, 0x83,
+    0x3e, 0x84, 0xc3, 0x09, 0xf0, 0xc2, 0x35, 0x48, 0x71, 0x84, 0x59, 0xd4, 0x19, 0xca, 0x90, 0x9a,
+    0x34, 0x9f, 0x12, 0xf3, 0x39, 0xb0, 0x52, 0xf6, 0xaa, 0x68, 0x29, 0xff, 0x8d, 0xb6, 0x00, 0xa6,
+    0x66, 0x81, 0x20, 0x18, 0x4b, 0x47, 0x8f, 0x0c, 0xdf, 0xe2, 0x29, 0xd8, 0xd4, 0x02, 0x6e, 0x2a,
+    0x3e, 0xc7, 0x75, 0x04, 0xee, 0x24, 0x31, 0x36, 0xa9, 0x9b, 0xaa, 0xd1, 0xb6, 0x8b, 0xc8, 0x51,
+    0x9c, 0x04, 0xcf, 0x28, 0x44, 0xec, 0x45, 0xc0, 0xe0, 0xe5, 0x7b, 0x21, 0x68, 0x33, 0xbd, 0x6c,
+    0x60, 0x12, 0xfb, 0x71, 0xe2, 0x46, 0x10, 0xf4, 0x6d, 0x71, 0xa3, 0x05, 0x91, 0xb2, 0x2c, 0x0a,
+    0x02, 0xad, 0x09, 0xd6, 0x9c, 0x7a, 0x50, 0xaa, 0x83, 0xdb, 0xc0, 0xe0, 0xcf, 0xe9, 0x56, 0x3d,
+    0x22, 0xc7, 0xb9, 0xe0, 0x18, 0x5c, 0x6c, 0x9c, 0x79, 0xb9, 0xd8, 0xb0, 0xeb, 0x2f, 0x01, 0xcb,
+    0x11, 0x04, 0x39, 0x2b, 0xa9, 0x29, 0x67, 0xf6, 0x40, 0xd8, 0x3b, 0xf7, 0x34, 0xf5, 0x43, 0x1d,
+    0xdc, 0xe8, 0xd3, 0xde, 0x46, 0x3d, 0xc7, 0xd7, 0x91, 0x0f, 0x11, 0x37, 0x4d, 0x15, 0x0a, 0xaf,
+    0x84, 0x82, 0xb4, 0x51, 0x92, 0xfb, 0x95, 0x6c, 0x67, 0x23, 0x49, 0x3e, 0xa6, 0x6e, 0x04, 0x1b,
+    0x74, 0x22, 0xb0, 0xdc, 0x5e, 0x33, 0x1e, 0xc7, 0x98, 0x7d, 0x00, 0xd0, 0xfe, 0x5c, 0x9f, 0x0f,
+    0x02, 0xc6, 0x30, 0xa4, 0x39, 0x84, 0x89, 0x36, 0xc6, 0x37, 0x04, 0x68, 0x49, 0x25, 0x1d, 0x4d,
+    0xc0, 0xd6, 0xae, 0xe4, 0x80, 0xa7, 0x6c, 0xfd, 0x2e, 0xc3, 0x48, 0x0d, 0x96, 0xb1, 0xcc, 0xc3,
+    0x3d, 0xa2, 0x5c, 0x59, 0x05, 0x94, 0x49, 0x58, 0xec, 0x17, 0x62, 0xa3, 0xce, 0xc8, 0x00, 0x65,
+    0xe8, 0x77, 0x49, 0x19, 0x63, 0x5d, 0x95, 0xb7, 0xcc, 0xe3, 0x4f, 0x7c, 0xad, 0xff, 0x03, 0x61,
+    0x76, 0x59, 0x01, 0xcb, 0xdd, 0x24, 0x85, 0xa6, 0x40, 0xee, 0x4a, 0xf6, 0x4b, 0x87, 0xb4, 0xa7,
+    0x9f, 0xe1, 0xad, 0x84, 0xe2, 0x27, 0xda, 0xc9, 0xd4, 0xb1, 0xea, 0xe3, 0xb4, 0xc9, 0xc4, 0xc2,
+    0xe5, 0x40, 0x20, 0x5d, 0xec, 0x33, 0x82, 0x38, 0x76, 0xfc, 0xe5, 0x43, 0xd4, 0x05, 0xd7, 0x7a,
+    0x06, 0x8a, 0x18, 0xd5, 0xbe, 0x58, 0x2b, 0xb1, 0xc9, 0x4f, 0x2a, 0x52, 0x0c, 0xb6, 0xca, 0xf0,
+    0x76, 0xea, 0x35, 0x98, 0xf0, 0x6b, 0x16, 0x4e, 0x9a, 0xd2, 0x49, 0x77, 0xfd, 0x06, 0x19, 0xb0,
+    0x18, 0x5a, 0x67, 0x8d, 0xf3, 0xe5, 0x69, 0x04, 0xc2, 0xf7, 0x06, 0x5e, 0xb0, 0x82, 0x60, 0x5e,
+    0xc4, 0x79, 0x74, 0xf7, 0x44, 0x2b, 0x03, 0x2b, 0x5e, 0x3b, 0x71, 0xe4, 0xa0, 0x5e, 0xab, 0xeb,
+    0x1a, 0x60, 0x4b, 0x51, 0x18, 0xbd, 0x98, 0x12, 0xcf, 0xa7, 0x5d, 0x36, 0xc5, 0x73, 0xe7, 0x3d,
+    0x6c, 0x89, 0xe3, 0x40, 0x16, 0x7b, 0xf2, 0x1d, 0x6f, 0xf8, 0x59, 0x1b, 0x04, 0x87, 0xeb, 0x5e,
+    0xab, 0x44, 0x84, 0x64, 0x46, 0x6e, 0x92, 0xad, 0x83, 0x3c, 0x39, 0x93, 0xc9, 0x44, 0xf3, 0x20,
+    0x97, 0x65, 0xd8, 0xec, 0x90, 0x45, 0x40, 0xc9, 0x30, 0x57, 0xde, 0x35, 0x75, 0xcd, 0xe3, 0x0a,
+    0xa6, 0x55, 0x7c, 0xc6, 0x60, 0x68, 0x84, 0xff, 0xb5, 0x0d, 0x67, 0x6f, 0x94, 0x3b, 0xb0, 0x30,
+    0x5c, 0x5f, 0x3c, 0xc9, 0x2d, 0xd3, 0x53, 0x10, 0xcf, 0x03, 0x8c, 0x58, 0x1f, 0x46, 0xb4, 0x6a,
+    0x4c, 0x73, 0x3d, 0xba, 0xe9, 0xdf, 0x25, 0x51, 0xc6, 0x5a, 0x06, 0x7b, 0x2e, 0xf0, 0x90, 0xfd,
+    0x1d, 0xd6, 0x8e, 0x59, 0xab, 0x7c, 0xf8, 0x83, 0xdb, 0x34, 0x1f, 0xbc, 0x9a, 0xf6, 0x7e, 0x2d,
+    0x98, 0x70, 0x26, 0xd3, 0x5f, 0x0e, 0xc2, 0x64, 0xf9, 0x40, 0x2d, 0xd4, 0x64, 0xcf, 0xd9, 0xd4,
+    0xe2, 0x5e, 0xd4, 0xc0, 0xed, 0x3e, 0x71, 0x4f, 0x82, 0x57, 0xa6, 0x8e, 0x1d, 0x05, 0x66, 0xe1,
+    0x86, 0x8b, 0x1d, 0xd4, 0x0c, 0xe4, 0xf6, 0x33, 0x56, 0xb9, 0x90, 0x30, 0xca, 0x40, 0x08, 0xf0,
+    0x66, 0x20, 0x2e, 0xc5, 0x40, 0x02, 0x42, 0x7b, 0xd6, 0x0e, 0x13, 0x95, 0xe7, 0x62, 0x9f, 0x39,
+    0x7c, 0x80, 0x81, 0xc8, 0x9f, 0x8e, 0x89, 0x7c, 0x74, 0x1f, 0x5e, 0x67, 0x4b, 0x40, 0x9b, 0x71,
+    0xac, 0x97, 0xfe, 0xb2, 0xce, 0x0f, 0xd4, 0x62, 0x0e, 0x2d, 0x5e, 0x87, 0x08, 0xd7, 0x69, 0x50,
+    0xf9, 0x95, 0xf6, 0x40, 0x52, 0x91, 0x9b, 0x2f, 0x98, 0x66, 0x37, 0x20, 0x5e, 0x67, 0x4d, 0x17,
+    0xc7, 0xe3, 0x30, 0xca, 0x15, 0x0f, 0xe4, 0x56, 0xac, 0x6f, 0xcf, 0xef, 0xea, 0x49, 0x76, 0x74,
+    0xca, 0xae, 0x48, 0x6f, 0xfe, 0xcd, 0xbe, 0x7c, 0x83, 0x75, 0xbf, 0xf4, 0xb4, 0x46, 0x89, 0x1e,
+    0xb0, 0x27, 0x85, 0x1a, 0xb1, 0xaa, 0xba, 0x3c, 0x2a, 0x24, 0x27, 0x8e, 0x4f, 0x4e, 0xc1, 0x08,
+    0xfe, 0xc4, 0x64, 0x94, 0x16, 0x11, 0x5f, 0x3b, 0x71, 0x74, 0x12, 0x22, 0x9c, 0x72, 0x75, 0x42,
+    0x32, 0xa4, 0x9a, 0x99, 0x3a, 0x89, 0x24, 0x8e, 0x52, 0x8e, 0x0d, 0x08, 0x6e, 0xeb, 0xd0, 0x28,
+    0x7d, 0x5a, 0x4c, 0x83, 0x6e, 0xc4, 0x34, 0xad, 0x97, 0x07, 0x74, 0x3d, 0x1e, 0x28, 0x6d, 0x59,
+    0x6d, 0xc8, 0xc4, 0x84, 0x2d, 0xac, 0x9c, 0xb7, 0xcf, 0x5c, 0x4d, 0xa6, 0xb1, 0x96, 0xc5, 0x36,
+    0xc2, 0x46, 0x9e, 0xa6, 0x65, 0x2d, 0x36, 0x62, 0x5f, 0xff, 0x6e, 0xe7, 0x87, 0x2f, 0x91, 0x1b,
+    0xb1, 0x6a, 0xb1, 0x57, 0xe3, 0x34, 0x08, 0x36, 0x08, 0xa4, 0xd2, 0x6e, 0x99, 0xb8, 0x0f, 0x27,
+    0xc8, 0x9a, 0x7a, 0xf8, 0x4a, 0x14, 0xe8, 0xfe, 0xe1, 0xc4, 0x91, 0xa0, 0x04, 0x15, 0xc5, 0xa8,
+    0xa5, 0x92, 0xad, 0x6b, 0xb7, 0xec, 0x5b, 0x97, 0x7c, 0x40, 0xac, 0xed, 0x6e, 0x77, 0x0b, 0x36,
+    0x94, 0xe6, 0x38, 0xa5, 0x90, 0x40, 0x28, 0x0a, 0xd7, 0x3f, 0x3a, 0xb5, 0x6f, 0x26, 0x56, 0xfb,
+    0xee, 0x3f, 0x19, 0xc8, 0xdd, 0xad, 0xb3, 0xed, 0x65, 0xc8, 0x7a, 0x36, 0x5c, 0x6f, 0x1b, 0x35,
+    0xcf, 0x1e, 0x3b, 0xf4, 0x9a, 0x84, 0xe2, 0x1b, 0x8c, 0x36, 0x54, 0x70, 0x6d, 0x05, 0xfb, 0x33,
+    0xba, 0xa9, 0x39, 0xeb, 0xda, 0xc0, 0x12, 0x1c, 0xfc, 0x63, 0xbe, 0x9d, 0x7b, 0x87, 0xa3, 0xe6,
+    0xf8, 0x89, 0x7f, 0xbe, 0x3a, 0x38, 0x58, 0x10, 0x8c, 0xfa, 0x77, 0x18, 0x1e, 0x5f, 0x06, 0xd7,
+    0x14, 0x4d, 0x0e, 0x70, 0x4a, 0x46, 0xaa, 0xd7, 0x69, 0xc8, 0xd2, 0xa8, 0x83, 0xf7, 0x42, 0x4d,
+    0xa6, 0x80, 0xfb, 0x8c, 0x9c, 0x03, 0x8d, 0x1d, 0x5e, 0x08, 0xde, 0xe3, 0x62, 0xa2, 0x1b, 0x2c,
+    0x56, 0xe3, 0x8d, 0xa5, 0x68, 0x94, 0xd5, 0x8e, 0xa8, 0x78, 0x5b, 0x9d, 0xaf, 0x1a, 0xce, 0x4e,
+    0xdf, 0x3c, 0x76, 0xf4, 0x15, 0xcb, 0xaa, 0x9f, 0x20, 0x7f, 0x68, 0x10, 0x33, 0x56, 0x3e, 0x80,
+    0x79, 0x19, 0x26, 0x9f, 0x8c, 0xae, 0x79, 0xbf, 0xbe, 0xed, 0x58, 0x96, 0x47, 0x36, 0x13, 0xc7,
+    0x9d, 0x63, 0x4c, 0xd2, 0xb0, 0xf0, 0xff, 0x66, 0x4b, 0x77, 0x38, 0x14, 0xbb, 0xed, 0xeb, 0x00,
+    0x55, 0x48, 0xc6, 0x1e, 0x56, 0xb5, 0xa0, 0xe5, 0x09, 0xa4, 0x84, 0xc8, 0x90, 0x6e, 0x42, 0xde,
+    0x02, 0xb3, 0x54, 0x27, 0x39, 0xc6, 0xa3, 0xe3, 0x37, 0xbc, 0x93, 0xac, 0x5b, 0x31, 0x1f, 0xf7,
+    0xa6, 0x6b, 0x08, 0xd1, 0x2f, 0xe6, 0x3f, 0xb5, 0x17, 0x1a, 0xbb, 0xf1, 0x9e, 0xb9, 0x8e, 0xa8,
+    0xd5, 0xc4, 0x29, 0xec, 0xc7, 0x8d, 0x0c, 0x86, 0x6f, 0x9b, 0x3a, 0x6d, 0x05, 0x94, 0x32, 0xe5,
+    0x7a, 0xd2, 0x64, 0xd6, 0x51, 0x4e, 0x8e, 0x3c, 0x69, 0xbc, 0x8d, 0x8a, 0xdc, 0xd3, 0x2d, 0xd9,
+    0x2b, 0x77, 0x9b, 0x17, 0x6f, 0xb3, 0xdf, 0xf8, 0x79, 0x77, 0x0f, 0x8e, 0x6b, 0x04, 0x7f, 0xbf,
+    0xb9, 0x89, 0x97, 0x56, 0xeb, 0xdf, 0xb4, 0x2f, 0x2f, 0x6d, 0x3f, 0x38, 0xd7, 0xfe, 0xe2, 0xc2,
+    0xce, 0xb9, 0xbb, 0xf6, 0xfa, 0x45, 0xd6, 0x80, 0x92, 0x0d, 0xb6, 0x3d, 0x04, 0xef, 0x28, 0x30,
+    0xa2, 0x82, 0x18, 0x05, 0xf2, 0x77, 0x15, 0xa3, 0xaa, 0x1c, 0xa7, 0xfe, 0x68, 0x90, 0x0a, 0xe8,
+    0x59, 0xd5, 0xb9, 0xbf, 0xe8, 0x5a, 0x85, 0xc4, 0x1b, 0x2d, 0x30, 0x54, 0x92, 0xd1, 0xf4, 0x39,
+    0x78, 0x13, 0x7d, 0xd0, 0x63, 0x94, 0x6f, 0x39, 0xbe, 0xc1, 0x07, 0x08, 0xf0, 0x57, 0xf3, 0x8f,
+    0x2c, 0xd3, 0x95, 0x72, 0xe7, 0xe8, 0x91, 0xaf, 0x3a, 0xdd, 0xee, 0x95, 0xba, 0xaa, 0x96, 0xdf,
+    0x02, 0x12, 0xd1, 0x2d, 0x5a, 0x16, 0xaa, 0xa8, 0xba, 0x6e, 0xa4, 0x64, 0x30, 0x4b, 0x9c, 0x01,
+    0xa6, 0x30, 0xcc, 0xf4, 0xdf, 0x5e, 0x39, 0x9d, 0xdc, 0x23, 0x12, 0x6c, 0xff, 0xe1, 0xa1, 0x60,
+    0x95, 0x27, 0x19, 0xff, 0x9f, 0xbf, 0x3a, 0x20, 0xc8, 0xe7, 0x0a, 0xfb, 0x28, 0x8a, 0xff, 0x39,
+    0xb0, 0x17, 0x0c, 0x5e, 0x0f, 0x61, 0xd4, 0x42, 0x66, 0x69, 0xe0, 0xe7, 0xfe, 0x6f, 0x08, 0xd1,
+    0x30, 0x2f, 0x5a, 0x6b, 0xe5, 0x4b, 0x05, 0xc9, 0x7f, 0x04, 0x99, 0x74, 0x65, 0x07, 0x76, 0x64,
+    0xc5, 0xee, 0x9d, 0xca, 0x30, 0xb8, 0x47, 0xb6, 0x62, 0x4b, 0x53, 0x0c, 0xce, 0x9e, 0xa0, 0x38,
+    0xbf, 0x5a, 0xe5, 0xdd, 0xba, 0x01, 0x3b, 0xfb, 0xe7, 0x18, 0xc7, 0xac, 0x03, 0x37, 0xb8, 0xfe,
+    0xbc, 0x88, 0xc1, 0xf9, 0x1f, 0x82, 0x15, 0xb0, 0xd0, 0xa4, 0x01, 0xfc, 0xdf, 0x66, 0x5c, 0xaf,
+    0x04, 0x09, 0x85, 0xd3, 0x30, 0x32, 0x96, 0x65, 0x3f, 0x13, 0x1e, 0xcb, 0xb2, 0xff, 0x0f, 0xf4,
+    0xff, 0x01, 0x25, 0xb4, 0xd0, 0x8f, 0x27, 0x54, 0x00, 0x00,
+};
+static const WebPage WEB_INDEX = {WEB_INDEX_GZ, sizeof(WEB_INDEX_GZ), "text/html", "\"0fcbfd8ad12f9786\""};
+
+// ota.html: 1773 -> 849 字节
+static const uint8_t WEB_OTA_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x55, 0xcd, 0x8e, 0xdb, 0x36,
+    0x10, 0xbe, 0xe7, 0x29, 0xa6, 0x0c, 0x02, 0xef, 0xa2, 0x91, 0x2c, 0xdb, 0x49, 0xb1, 0xd1, 0x8f,
+    0x81, 0xb4, 0x49, 0x80, 0x9c, 0x36, 0x40, 0xb6, 0x87, 0xa2, 0xe8, 0x81, 0x12, 0x29, 0x8b, 0x08,
+    0x45, 0xb2, 0x14, 0xe5, 0x5d, 0x37, 0x58, 0xa0, 0xb7, 0x1c, 0x82, 0x3e, 0x41, 0x1f, 0x20, 0xa7,
+    0x5e, 0x8b, 0x22, 0xed, 0xe3, 0x64, 0xd1, 0xd7, 0x28, 0x49, 0x89, 0x6b, 0xd9, 0xdb, 0xd5, 0xc1,
+    0x26, 0x67, 0x86, 0xdf, 0x7c, 0xf3, 0x69, 0x86, 0xca, 0xbf, 0x7a, 0x71, 0xfe, 0xdd, 0xc5, 0x0f,
+    0x6f, 0x5e, 0x42, 0x63, 0x5a, 0xbe, 0x7e, 0x90, 0x87, 0x3f, 0x8a, 0xc9, 0xfa, 0x01, 0xd8, 0x27,
+    0x6f, 0xa9, 0xc1, 0x50, 0x35, 0x58, 0x77, 0xd4, 0x14, 0xe8, 0xfb, 0x8b, 0x57, 0xd1, 0x19, 0x9a,
+    0xba, 0x04, 0x6e, 0x69, 0x81, 0xb6, 0x8c, 0x5e, 0x2a, 0xa9, 0x0d, 0x82, 0x4a, 0x0a, 0x43, 0x85,
+    0x0d, 0xbd, 0x64, 0xc4, 0x34, 0x05, 0xa1, 0x5b, 0x56, 0xd1, 0xc8, 0x6f, 0x1e, 0x03, 0x13, 0xcc,
+    0x30, 0xcc, 0xa3, 0xae, 0xc2, 0x9c, 0x16, 0x8b, 0x38, 0x09, 0x50, 0x86, 0x19, 0x4e, 0xd7, 0x6f,
+    0x59, 0x2b, 0xe1, 0xfc, 0xe2, 0xf9, 0xcd, 0x6f, 0x1f, 0xfe, 0xfd, 0xfc, 0x29, 0x9f, 0x0f, 0xd6,
+    0x21, 0xa2, 0x33, 0xbb, 0xb0, 0x76, 0x4f, 0x29, 0xc9, 0x0e, 0xde, 0x43, 0x6d, 0xb3, 0x45, 0x35,
+    0x6e, 0x19, 0xdf, 0xa5, 0xf0, 0x5c, 0x5b, 0xec, 0x0c, 0x4a, 0x5c, 0xbd, 0xdb, 0x68, 0xd9, 0x0b,
+    0x92, 0xc2, 0xc3, 0x05, 0x5e, 0xe0, 0x25, 0xcd, 0x2c, 0x2d, 0x2e, 0xb5, 0xdd, 0xd7, 0x75, 0x9d,
+    0x81, 0xc2, 0x84, 0x30, 0xb1, 0x49, 0x61, 0x99, 0xa8, 0xab, 0x0c, 0x0c, 0xbd, 0x32, 0x11, 0xe6,
+    0x6c, 0x23, 0x52, 0xa8, 0x2c, 0x77, 0xaa, 0x33, 0xb8, 0xbe, 0xcd, 0xd4, 0x2c, 0x6d, 0x9e, 0x70,
+    0x3c, 0x49, 0xc8, 0x33, 0x87, 0xb0, 0x77, 0xc7, 0xbd, 0xe2, 0x12, 0x93, 0xa8, 0x94, 0x57, 0x36,
+    0xee, 0x30, 0xf7, 0x37, 0xcb, 0xc5, 0x8a, 0x4e, 0xd2, 0xad, 0x7c, 0xba, 0x52, 0x6a, 0x42, 0x75,
+    0xa4, 0x31, 0x61, 0x7d, 0x97, 0xc2, 0xe2, 0xa9, 0x33, 0xb6, 0x58, 0x6f, 0x98, 0x18, 0x18, 0x01,
+    0xee, 0x8d, 0x74, 0xa6, 0xab, 0x41, 0xb7, 0x14, 0x9e, 0x24, 0xfe, 0xe4, 0x3e, 0x2b, 0x13, 0xaa,
+    0x37, 0x3f, 0x9a, 0x9d, 0xb2, 0xda, 0xd7, 0x8c, 0x53, 0xf4, 0x93, 0x4d, 0x7e, 0x80, 0x91, 0x4c,
+    0xc3, 0xcb, 0xde, 0x18, 0x29, 0x8e, 0xf9, 0x85, 0x62, 0xf6, 0xc5, 0x25, 0x81, 0x5d, 0x0a, 0x42,
+    0x8a, 0x29, 0x75, 0xc7, 0xd2, 0xd2, 0x70, 0x2c, 0xbc, 0xe6, 0x1d, 0xfb, 0x85, 0x5a, 0xeb, 0xd9,
+    0xff, 0x15, 0xe4, 0xa3, 0xaa, 0x5e, 0x77, 0x0e, 0x55, 0x49, 0x76, 0xac, 0xe8, 0xc0, 0x26, 0x6d,
+    0xe4, 0x96, 0xea, 0xbb, 0x9c, 0xca, 0x33, 0xf2, 0x64, 0x1a, 0xfd, 0x50, 0x69, 0xb9, 0xd1, 0xb4,
+    0xeb, 0x6e, 0x2b, 0x8c, 0x8c, 0x54, 0xe1, 0xdd, 0x4d, 0x5e, 0x44, 0x89, 0xef, 0xa0, 0xad, 0x56,
+    0xab, 0x7b, 0xe8, 0x35, 0x94, 0x6d, 0x1a, 0x13, 0x50, 0x1c, 0x93, 0x9a, 0xcb, 0xcb, 0x14, 0x1a,
+    0x46, 0x08, 0x15, 0x07, 0xb8, 0x56, 0x5f, 0x7e, 0x9f, 0x74, 0x01, 0x66, 0x91, 0x24, 0x8f, 0x32,
+    0x18, 0xdf, 0x96, 0x5b, 0x1a, 0x8d, 0x45, 0x67, 0x9b, 0xdd, 0xd6, 0x39, 0x98, 0x21, 0x89, 0x57,
+    0x5d, 0xc0, 0xcd, 0xe7, 0x63, 0x3b, 0xe7, 0xf3, 0x61, 0xd4, 0x72, 0xd7, 0xcf, 0x63, 0xa7, 0x37,
+    0xcb, 0x61, 0x10, 0x6e, 0x7e, 0xff, 0xfc, 0xe5, 0xef, 0x3f, 0xc3, 0x2c, 0x58, 0xeb, 0xe0, 0x26,
+    0x6c, 0x0b, 0x15, 0xc7, 0x5d, 0x57, 0xa0, 0x7d, 0xeb, 0xa1, 0xfd, 0x64, 0xe4, 0xb5, 0xd4, 0x2d,
+    0xd8, 0xd9, 0x6c, 0x24, 0x29, 0xd0, 0x9b, 0xf3, 0xb7, 0x17, 0x08, 0x70, 0xe5, 0x98, 0x14, 0x68,
+    0xde, 0x2b, 0x82, 0x0d, 0x45, 0x40, 0x45, 0x35, 0x34, 0x4f, 0xdb, 0x73, 0xc3, 0x14, 0xd6, 0x66,
+    0xee, 0x8e, 0x45, 0xd6, 0x8b, 0x11, 0x30, 0x12, 0xb0, 0x5f, 0x59, 0xe3, 0x04, 0xdb, 0xe3, 0xfb,
+    0xde, 0x83, 0x49, 0xef, 0x8d, 0x77, 0x40, 0xc0, 0xc6, 0x55, 0x45, 0x95, 0xbd, 0x00, 0xe2, 0x92,
+    0x09, 0x04, 0x9a, 0xfe, 0xdc, 0x33, 0x4d, 0xc9, 0x3a, 0x2f, 0xf5, 0x11, 0xd0, 0xd8, 0x95, 0x03,
+    0x52, 0xd7, 0x97, 0x2d, 0x33, 0x68, 0x7d, 0xf3, 0xcf, 0xaf, 0x37, 0x9f, 0x3e, 0x86, 0xaa, 0x87,
+    0x90, 0x49, 0x71, 0x9e, 0xe6, 0x64, 0xef, 0xd4, 0x70, 0x74, 0x43, 0x93, 0x20, 0xf0, 0xca, 0x16,
+    0x88, 0xb0, 0x4e, 0x71, 0xbc, 0x4b, 0x7d, 0x1f, 0x1f, 0x97, 0xa0, 0xd6, 0x43, 0x82, 0x2f, 0x7f,
+    0xfd, 0x11, 0xc7, 0x71, 0x3e, 0x57, 0x47, 0xfe, 0x89, 0xc6, 0xb6, 0xab, 0xd0, 0x7a, 0x6a, 0x70,
+    0xed, 0x30, 0x48, 0xe4, 0x57, 0xeb, 0x7c, 0x6e, 0x9d, 0xe3, 0xef, 0x84, 0xe7, 0xed, 0x76, 0xba,
+    0xec, 0x2a, 0xcd, 0x94, 0xd9, 0x87, 0x11, 0x59, 0xf5, 0xad, 0xbd, 0x71, 0xe2, 0x0d, 0x35, 0x2f,
+    0x39, 0x75, 0xcb, 0x6f, 0x77, 0xaf, 0xc9, 0xc9, 0x6c, 0xaf, 0xfe, 0xec, 0x34, 0x96, 0x62, 0x10,
+    0x07, 0x0a, 0xa8, 0x7b, 0xe1, 0x5f, 0xe5, 0xc9, 0x29, 0xbc, 0x3f, 0xa0, 0x7c, 0x2f, 0x52, 0x10,
+    0xc6, 0xe2, 0x78, 0x65, 0xe2, 0x51, 0x18, 0x0b, 0x36, 0x2b, 0xb9, 0xac, 0xde, 0xcd, 0xb2, 0x03,
+    0xa0, 0xad, 0x9d, 0x22, 0xdf, 0xf1, 0xc5, 0xfd, 0x98, 0xce, 0x3f, 0x3b, 0xbd, 0x7b, 0x4e, 0xd9,
+    0x43, 0xc9, 0x5d, 0xb3, 0x61, 0xad, 0x1d, 0xf4, 0x02, 0xec, 0x17, 0xe4, 0xb5, 0xbb, 0x0b, 0xb6,
+    0x98, 0x9f, 0x4c, 0x0b, 0x01, 0x56, 0x9f, 0x28, 0xc8, 0xe1, 0x59, 0xe2, 0x36, 0x0a, 0xbe, 0x2e,
+    0xec, 0x3c, 0x65, 0x9e, 0xc5, 0xc8, 0x79, 0x98, 0xa0, 0xc2, 0xf9, 0x60, 0xf6, 0x68, 0x66, 0xc7,
+    0x08, 0xae, 0x1f, 0xc3, 0xd3, 0x24, 0x99, 0x90, 0xb8, 0xce, 0xc2, 0x68, 0x8d, 0x22, 0xdb, 0xee,
+    0xf1, 0x43, 0x65, 0x67, 0xc7, 0x7f, 0xd5, 0xfe, 0x03, 0x9c, 0x0c, 0x8b, 0x20, 0xed, 0x06, 0x00,
+    0x00,
+};
+static const WebPage WEB_OTA = {WEB_OTA_GZ, sizeof(WEB_OTA_GZ), "text/html", "\"93ecfa309c990e5a\""};
+
+// wifi.html: 3046 -> 1200 字节
+static const uint8_t WEB_WIFI_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x56, 0x5b, 0x8f, 0xdb, 0x44,
+    0x14, 0x7e, 0xef, 0xaf, 0x98, 0xba, 0x42, 0x4e, 0xd4, 0x8d, 0xe3, 0x64, 0x2f, 0x2c, 0x89, 0x13,
+    0xa9, 0x97, 0x5d, 0x51, 0xa9, 0xd0, 0x15, 0xbb, 0x55, 0x85, 0xd4, 0x97, 0x89, 0x3d, 0x8e, 0x87,
+    0x75, 0x66, 0xdc, 0xf1, 0x38, 0xd9, 0xb0, 0xda, 0x07, 0x1e, 0x8a, 0xe0, 0xa1, 0x14, 0x84, 0x84,
+    0x78, 0x28, 0x17, 0x89, 0xae, 0x40, 0xa0, 0xa5, 0x45, 0x42, 0x50, 0x84, 0xda, 0xfe, 0x99, 0xcd,
+    0xee, 0xf2, 0xc6, 0x4f, 0xe0, 0x8c, 0x1d, 0xc7, 0x71, 0xe2, 0x5d, 0xb6, 0xcd, 0x4b, 0x3c, 0xe3,
+    0x39, 0xdf, 0x77, 0xce, 0x77, 0x2e, 0x63, 0xeb, 0xe2, 0xf5, 0x5b, 0xd7, 0xb6, 0xde, 0xdf, 0x58,
+    0x43, 0x9e, 0xec, 0xf9, 0xed, 0x0b, 0x56, 0xfa, 0x47, 0xb0, 0xd3, 0xbe, 0x80, 0xe0, 0x67, 0xf5,
+    0x88, 0xc4, 0xc8, 0xf6, 0xb0, 0x08, 0x89, 0x6c, 0x69, 0xb7, 0xb7, 0xd6, 0x2b, 0xab, 0xda, 0xf4,
+    0x2b, 0x86, 0x7b, 0xa4, 0xa5, 0xf5, 0x29, 0x19, 0x04, 0x5c, 0x48, 0x0d, 0xd9, 0x9c, 0x49, 0xc2,
+    0xe0, 0xe8, 0x80, 0x3a, 0xd2, 0x6b, 0x39, 0xa4, 0x4f, 0x6d, 0x52, 0x89, 0x17, 0x0b, 0x88, 0x32,
+    0x2a, 0x29, 0xf6, 0x2b, 0xa1, 0x8d, 0x7d, 0xd2, 0xaa, 0x19, 0x66, 0x0a, 0x25, 0xa9, 0xf4, 0x49,
+    0x7b, 0x93, 0xf6, 0x38, 0xba, 0x43, 0xd7, 0xe9, 0x3f, 0xf7, 0x1f, 0x1c, 0x3f, 0xff, 0xd5, 0xaa,
+    0x26, 0xdb, 0xc9, 0x91, 0x50, 0x0e, 0xd3, 0x67, 0xf5, 0xeb, 0x70, 0x67, 0x88, 0x76, 0x91, 0x0b,
+    0x74, 0x15, 0x17, 0xf7, 0xa8, 0x3f, 0x6c, 0xa0, 0x2b, 0x02, 0xc0, 0x9b, 0xa8, 0x83, 0xed, 0xed,
+    0xae, 0xe0, 0x11, 0x73, 0x1a, 0xe8, 0x52, 0x0d, 0xd7, 0x70, 0x9d, 0x34, 0xc1, 0x2f, 0x9f, 0x0b,
+    0x58, 0xbb, 0xae, 0xdb, 0x44, 0x01, 0x76, 0x1c, 0xca, 0xba, 0x0d, 0x54, 0x37, 0x83, 0x9d, 0x26,
+    0xda, 0x9b, 0xa0, 0x7a, 0x75, 0xc0, 0x4c, 0x8f, 0x9a, 0xa6, 0xf3, 0x96, 0x3a, 0x2d, 0xc9, 0x8e,
+    0xac, 0x60, 0x9f, 0x76, 0x59, 0x03, 0xd9, 0x10, 0x1b, 0x11, 0xd3, 0x26, 0x46, 0x87, 0xef, 0x80,
+    0x51, 0x9e, 0x74, 0xa5, 0x5e, 0x5b, 0x24, 0x73, 0x3c, 0x1d, 0x2e, 0x1c, 0x22, 0x2a, 0x02, 0x3b,
+    0x34, 0x0a, 0x1b, 0xa8, 0xb6, 0xac, 0x36, 0x7b, 0x78, 0x27, 0x91, 0xa7, 0x81, 0x16, 0x97, 0xcd,
+    0x64, 0x47, 0x74, 0x29, 0x4b, 0x8c, 0x10, 0x8e, 0x24, 0x9f, 0xa6, 0xf3, 0x71, 0x87, 0xf8, 0xc0,
+    0xe7, 0xd0, 0x30, 0xf0, 0x31, 0x04, 0xdd, 0xf1, 0xb9, 0xbd, 0x9d, 0x19, 0x29, 0x50, 0x64, 0xa2,
+    0xe5, 0x7c, 0x5c, 0x94, 0x05, 0x91, 0x5c, 0x40, 0x21, 0xf1, 0x89, 0x2d, 0xc1, 0x7a, 0x4c, 0x58,
+    0x33, 0xcd, 0x37, 0xa6, 0xbc, 0xac, 0xd5, 0x33, 0x2f, 0x1b, 0x88, 0x71, 0x46, 0xe6, 0x7c, 0x5e,
+    0x55, 0x27, 0x62, 0xd1, 0x43, 0xfa, 0x21, 0x01, 0x93, 0x95, 0x3c, 0x51, 0x27, 0x92, 0x92, 0xb3,
+    0x59, 0x86, 0x9c, 0x38, 0xa9, 0xac, 0x99, 0xcc, 0xe6, 0x2c, 0x69, 0xe6, 0xd1, 0xf2, 0x2c, 0xdf,
+    0x6a, 0x91, 0x90, 0xb1, 0x6c, 0x76, 0x24, 0x42, 0x05, 0x18, 0x70, 0x9a, 0xe4, 0x28, 0x91, 0xa4,
+    0x22, 0x79, 0x30, 0x9f, 0xe8, 0xc4, 0xcf, 0x86, 0xc7, 0xfb, 0x44, 0xcc, 0x66, 0xcf, 0x34, 0x3b,
+    0xab, 0xce, 0x52, 0x2e, 0xc7, 0x50, 0xb0, 0x6c, 0xf6, 0xd8, 0xd2, 0xb5, 0x2b, 0xeb, 0xcb, 0xe6,
+    0x84, 0xa6, 0xc3, 0x01, 0xb1, 0x97, 0x3a, 0x93, 0xd9, 0x5e, 0x62, 0x44, 0x0e, 0xb8, 0xd8, 0x0e,
+    0xc1, 0x5e, 0xe5, 0xda, 0x23, 0xb4, 0xeb, 0x49, 0xe5, 0x51, 0x7c, 0x50, 0x39, 0xe0, 0xfa, 0x7c,
+    0x50, 0x81, 0x54, 0xce, 0xe6, 0xda, 0x00, 0x53, 0xb0, 0xca, 0xd4, 0xc8, 0x95, 0x47, 0x9c, 0xe8,
+    0x59, 0x6d, 0xdd, 0xc5, 0xa5, 0x15, 0xb3, 0x38, 0x6b, 0x73, 0xfa, 0xe4, 0x89, 0x8a, 0xb5, 0xa8,
+    0xe1, 0x25, 0xfc, 0x26, 0xce, 0x6b, 0x21, 0xb1, 0x8c, 0x54, 0x34, 0x45, 0x7d, 0x31, 0xad, 0x79,
+    0x92, 0xbc, 0x34, 0xcd, 0x18, 0x4f, 0x60, 0xac, 0xea, 0xb8, 0x99, 0xad, 0x6a, 0x32, 0x69, 0x2c,
+    0xd5, 0xcd, 0xe3, 0x3e, 0xf7, 0xea, 0xed, 0x7f, 0xbf, 0x7b, 0xfc, 0x15, 0x9a, 0x1b, 0x06, 0xf0,
+    0x22, 0x39, 0xe1, 0xd0, 0x3e, 0xb2, 0x7d, 0x1c, 0x86, 0x2d, 0x0d, 0x7a, 0x4f, 0xcb, 0x66, 0x82,
+    0x35, 0xae, 0xbe, 0xf1, 0x4b, 0x95, 0x34, 0x0d, 0x71, 0x66, 0xfb, 0xd4, 0xde, 0x4e, 0x96, 0xa5,
+    0xb2, 0xd6, 0x3e, 0xfa, 0xf4, 0x97, 0xa3, 0x87, 0x0f, 0x15, 0xf2, 0xf1, 0xf3, 0x2f, 0x8e, 0xff,
+    0x7e, 0x64, 0x55, 0x13, 0xb3, 0x29, 0x1c, 0xc5, 0x40, 0x9d, 0x96, 0x96, 0xa6, 0x4e, 0x6b, 0x5b,
+    0x55, 0xd8, 0x9b, 0x3a, 0x11, 0xb7, 0x61, 0x5b, 0x81, 0x8c, 0x3e, 0x7f, 0x70, 0xfc, 0xe3, 0x53,
+    0x54, 0xda, 0xdc, 0xbc, 0x71, 0xbd, 0x6c, 0x55, 0x93, 0x17, 0xd9, 0xc1, 0xb8, 0xf3, 0x90, 0x1c,
+    0x06, 0x30, 0x25, 0x95, 0x60, 0x5a, 0x0c, 0x1c, 0x86, 0xd4, 0xd1, 0x90, 0x20, 0xf7, 0x22, 0x2a,
+    0x88, 0x53, 0x8c, 0xfb, 0xe4, 0xe3, 0xe3, 0xef, 0x3f, 0x3a, 0x1b, 0x30, 0x80, 0x38, 0xc1, 0x41,
+    0x27, 0x01, 0x9d, 0xac, 0xe6, 0x15, 0xc9, 0x44, 0xc0, 0x7d, 0x72, 0x87, 0xba, 0x54, 0x09, 0x71,
+    0xf8, 0xf2, 0x9b, 0xd1, 0xc1, 0xd7, 0xa3, 0xbf, 0xfe, 0x38, 0x79, 0xf9, 0xed, 0xd1, 0x67, 0xfb,
+    0x05, 0x3a, 0x04, 0x13, 0x29, 0xe3, 0x9c, 0x8f, 0x7d, 0x4f, 0x9e, 0x41, 0x92, 0x60, 0x9c, 0x90,
+    0x4c, 0x1b, 0x2b, 0xb4, 0x05, 0x0d, 0x64, 0x06, 0xe1, 0x46, 0xcc, 0x96, 0x14, 0x3c, 0x48, 0xd4,
+    0x47, 0xbb, 0x93, 0x37, 0xea, 0xe7, 0x70, 0x3b, 0xea, 0x41, 0xe5, 0x18, 0x5d, 0x22, 0xd7, 0x7c,
+    0xa2, 0x1e, 0xaf, 0x0e, 0x6f, 0x38, 0x25, 0x3d, 0xe1, 0xd0, 0xcb, 0x06, 0x65, 0x8c, 0x88, 0x2d,
+    0xd0, 0x0d, 0xb5, 0x90, 0x9e, 0x64, 0xee, 0xf0, 0xd9, 0x81, 0x61, 0x18, 0x7a, 0x33, 0x87, 0xe4,
+    0x12, 0x69, 0x7b, 0x25, 0xbd, 0x3a, 0x80, 0xd8, 0xaa, 0x8a, 0x0b, 0x6c, 0xa5, 0x47, 0x58, 0x49,
+    0xa0, 0x56, 0x1b, 0x09, 0xe3, 0x83, 0x90, 0x03, 0xfd, 0x78, 0xcf, 0xc1, 0x70, 0x71, 0xc1, 0x76,
+    0xde, 0x99, 0x78, 0xba, 0x42, 0xc3, 0xa9, 0x3b, 0x50, 0xb1, 0xcd, 0x30, 0xc4, 0xfe, 0x82, 0xa1,
+    0xe1, 0x72, 0xb1, 0x86, 0x81, 0x8c, 0x15, 0x43, 0xc4, 0xd7, 0x88, 0x82, 0xb8, 0x0c, 0x18, 0xd3,
+    0xb5, 0x0a, 0xc5, 0x34, 0x5d, 0x8d, 0xf1, 0x28, 0x7e, 0x97, 0xc8, 0xd2, 0x5d, 0x5d, 0x47, 0x97,
+    0x11, 0x33, 0x54, 0x4d, 0xc0, 0x83, 0x7e, 0x57, 0x87, 0xdc, 0xe4, 0xb7, 0x50, 0x29, 0x59, 0x0b,
+    0xd8, 0x50, 0x6b, 0xe7, 0x6a, 0xaf, 0x9c, 0xa8, 0x5e, 0xe0, 0xe4, 0x5e, 0xb9, 0xc0, 0xf1, 0xd3,
+    0x84, 0x4e, 0x2b, 0x3c, 0x95, 0xfa, 0xed, 0xad, 0x77, 0x6e, 0x42, 0xf0, 0x2a, 0x80, 0x57, 0x40,
+    0x39, 0x2d, 0x5d, 0x2f, 0x46, 0x9f, 0x3c, 0x45, 0xca, 0xf5, 0x58, 0x38, 0x9f, 0xb0, 0xae, 0xf4,
+    0xe2, 0x78, 0x0e, 0x9f, 0xfd, 0x9c, 0x34, 0xdf, 0x8c, 0xff, 0x7b, 0x65, 0xc3, 0xc6, 0x2a, 0x93,
+    0xa4, 0x58, 0xdc, 0xd7, 0x2a, 0x98, 0xd1, 0xe3, 0xdf, 0x4e, 0x7e, 0xdf, 0x9f, 0x63, 0xca, 0xd6,
+    0x7b, 0x05, 0xe5, 0x3a, 0x49, 0x8f, 0xca, 0xc1, 0xf9, 0xeb, 0x16, 0x0e, 0x83, 0x13, 0x7d, 0xec,
+    0x47, 0x10, 0x01, 0x52, 0xcb, 0xb3, 0x69, 0x26, 0xed, 0x38, 0xc3, 0x00, 0x9f, 0x51, 0xa1, 0x8c,
+    0xed, 0x01, 0xe6, 0x5c, 0x74, 0xcd, 0x02, 0x7b, 0x35, 0x11, 0xce, 0xb2, 0x4f, 0x27, 0x46, 0x31,
+    0x06, 0x75, 0x51, 0xe9, 0xe2, 0x38, 0xfc, 0x57, 0x55, 0xfe, 0xe4, 0xc9, 0x9f, 0x27, 0x2f, 0xbe,
+    0x1c, 0xdd, 0xdf, 0xcf, 0x46, 0xa4, 0xde, 0x84, 0x81, 0x27, 0x23, 0xc1, 0xa6, 0x6f, 0x93, 0xd7,
+    0x49, 0xea, 0xc1, 0x0f, 0xa3, 0x47, 0x3f, 0x25, 0x33, 0xeb, 0xff, 0x06, 0x01, 0xc8, 0xab, 0x2f,
+    0xa8, 0x8b, 0x97, 0x48, 0x8f, 0xc3, 0x7d, 0xa6, 0x6f, 0xdc, 0xda, 0xdc, 0x82, 0x1d, 0x75, 0xdf,
+    0xc0, 0xc7, 0x06, 0x19, 0xa0, 0xdb, 0xef, 0xdd, 0xdc, 0x24, 0x58, 0xd8, 0xde, 0x06, 0x16, 0xb8,
+    0x17, 0x96, 0x76, 0x55, 0xc0, 0x8d, 0x58, 0xf9, 0x05, 0x94, 0xea, 0xd3, 0x88, 0x9f, 0xf6, 0xca,
+    0x50, 0x35, 0x73, 0x25, 0x99, 0x1b, 0x33, 0x6a, 0xc2, 0x4f, 0xc6, 0x8c, 0x3c, 0x7d, 0x40, 0x9c,
+    0x33, 0xe4, 0x71, 0x37, 0xca, 0xb3, 0x9b, 0x7c, 0x72, 0xa9, 0x8e, 0x67, 0x2f, 0x0c, 0xf2, 0xf8,
+    0x3a, 0x85, 0x2b, 0x33, 0xfe, 0x9c, 0xff, 0x0f, 0x7d, 0x03, 0x3a, 0x93, 0xe6, 0x0b, 0x00, 0x00,
+};
+static const WebPage WEB_WIFI = {WEB_WIFI_GZ, sizeof(WEB_WIFI_GZ), "text/html", "\"d2c09ebf7ded43d1\""};
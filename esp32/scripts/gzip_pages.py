@@ -0,0 +1,77 @@
+"""
+网页预压缩（PlatformIO extra_scripts，编译前执行）
+
+web/*.html → gzip → include/web_pages.h 中的 PROGMEM 字节数组，
+运行时原样发送（Content-Encoding: gzip），不在 ESP32 上压缩、也不经过堆 String。
+ETag 取压缩后数据的 SHA-1 前 16 位：页面不变时 ETag 不变，浏览器缓存跨固件版本仍然有效。
+
+gzip 头不写时间和文件名，同样的输入总是得到同样的输出；内容没变时不改写头文件，
+避免触发重新编译。也可以单独运行：python scripts/gzip_pages.py
+"""
+
+import gzip
+import hashlib
+import os
+
+# (web/ 下的文件名, C 标识符前缀, Content-Type)
+PAGES = [
+    ("index.html", "WEB_INDEX", "text/html"),
+    ("ota.html", "WEB_OTA", "text/html"),
+    ("wifi.html", "WEB_WIFI", "text/html"),
+]
+
+
+def render(project_dir):
+    out = [
+        "/**",
+        " * 预压缩网页（scripts/gzip_pages.py 由 web/ 下的 .html 生成，不要手工修改）",
+        " */",
+        "",
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct WebPage {",
+        "    const uint8_t* gz;      // gzip 数据（flash）",
+        "    size_t len;",
+        "    const char* type;",
+        "    const char* etag;       // 含引号，可直接用作 ETag 响应头",
+        "};",
+        "",
+    ]
+    for name, ident, ctype in PAGES:
+        with open(os.path.join(project_dir, "web", name), "rb") as f:
+            raw = f.read()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha1(gz).hexdigest()[:16]
+        out.append("// %s: %d -> %d 字节" % (name, len(raw), len(gz)))
+        out.append("static const uint8_t %s_GZ[] PROGMEM = {" % ident)
+        for i in range(0, len(gz), 16):
+            out.append("    " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+        out.append("};")
+        out.append('static const WebPage %s = {%s_GZ, sizeof(%s_GZ), "%s", "\\"%s\\""};'
+                   % (ident, ident, ident, ctype, etag))
+        out.append("")
+    return "\n".join(out)
+
+
+def generate(project_dir):
+    path = os.path.join(project_dir, "include", "web_pages.h")
+    text = render(project_dir)
+    try:
+        with open(path, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    except FileNotFoundError:
+        pass
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    print("gzip_pages: 已更新 include/web_pages.h")
+
+
+try:
+    Import("env")  # noqa: F821（PlatformIO/SCons 提供）
+    generate(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        generate(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,94 @@
+/**
+ * 巡逻避障引擎实现，见 avoidance.h
+ */
+
+#include "avoidance.h"
+
+void AvoidanceEngine::reset() {
+    state_ = IDLE;
+    busyUntil_ = 0;
+    cruisePwm_ = 0;
+    lastTurnAt_ = 0;
+    leftBlockedAt_ = rightBlockedAt_ = 0;
+}
+
+// 距离 → 前进速度：AVOID_TURN_MM 处最低，AVOID_FREE_MM 以外全速
+uint8_t AvoidanceEngine::speedFor(int distanceMm) {
+    if (distanceMm <= 0 || distanceMm >= AVOID_FREE_MM) return AVOID_PWM_MAX;
+    if (distanceMm <= AVOID_TURN_MM) return AVOID_PWM_MIN;
+    return AVOID_PWM_MIN + (AVOID_PWM_MAX - AVOID_PWM_MIN) * (distanceMm - AVOID_TURN_MM) /
+                           (AVOID_FREE_MM - AVOID_TURN_MM);
+}
+
+AvoidAction AvoidanceEngine::onSample(const AvoidSample& s) {
+    const AvoidAction none = {AvoidAction::NONE, 0, 0};
+    bool busy = (long)(busyUntil_ - s.at) > 0;
+    int dist = s.distanceValid ? s.distanceMm : 0;
+    bool tooClose = dist > 0 && dist < AVOID_STOP_MM;
+    bool near = dist > 0 && dist < AVOID_TURN_MM;
+
+    if (s.obsLeft) leftBlockedAt_ = s.at;
+    if (s.obsRight) rightBlockedAt_ = s.at;
+
+    // 后退结束后转向
+    if (state_ == BACK) {
+        return busy ? none : turn(s);
+    }
+    // 转向中：转完再判断（转向时前方读数一直在变，中途后退会来回摇摆）
+    if (state_ == TURN && busy) {
+        return none;
+    }
+    // 太近原地转不开，先后退
+    if (tooClose) {
+        return act(AvoidAction::BACK, AVOID_TURN_PWM, AVOID_BACK_MS, s.at);
+    }
+    if (near || s.obsLeft || s.obsRight) {
+        return turn(s);
+    }
+
+    // 前方空旷：按距离调速；速度变化明显或命令快到时才重发
+    uint8_t pwm = speedFor(dist);
+    if (!s.distanceValid && pwm > AVOID_PWM_UNSURE) pwm = AVOID_PWM_UNSURE;
+    int diff = (int)pwm - (int)cruisePwm_;
+    if (state_ != CRUISE || diff >= AVOID_PWM_STEP || diff <= -AVOID_PWM_STEP ||
+        (long)(busyUntil_ - s.at) < AVOID_REFRESH_MS) {
+        cruisePwm_ = pwm;
+        return act(AvoidAction::FORWARD, pwm, AVOID_CRUISE_MS, s.at);
+    }
+    return none;
+}
+
+AvoidAction AvoidanceEngine::onTick(unsigned long now, unsigned long lastSampleAt) {
+    if (state_ != IDLE && now - lastSampleAt > AVOID_STALE_MS) {
+        state_ = IDLE;
+        return {AvoidAction::STOP, 0, 0};
+    }
+    return {AvoidAction::NONE, 0, 0};
+}
+
+// 只有一侧被挡：转向另一侧；否则刚避让过就沿用上次方向，
+// 再否则转向最近较少被挡的一侧
+AvoidAction AvoidanceEngine::turn(const AvoidSample& s) {
+    bool left;
+    if (s.obsLeft != s.obsRight) {
+        left = s.obsRight;
+    } else if (lastTurnAt_ != 0 && s.at - lastTurnAt_ < AVOID_SAME_SIDE_MS) {
+        left = lastTurnLeft_;
+    } else {
+        left = leftBlockedAt_ <= rightBlockedAt_;
+    }
+    lastTurnLeft_ = left;
+    lastTurnAt_ = s.at;
+    return act(left ? AvoidAction::TURN_LEFT : AvoidAction::TURN_RIGHT, AVOID_TURN_PWM, AVOID_TURN_MS, s.at);
+}
+
+AvoidAction AvoidanceEngine::act(AvoidAction::Type type, uint8_t pwm, uint16_t ms, unsigned long now) {
+    switch (type) {
+        case AvoidAction::FORWARD: state_ = CRUISE; break;
+        case AvoidAction::BACK: state_ = BACK; break;
+        case AvoidAction::STOP: state_ = IDLE; break;
+        default: state_ = TURN; break;
+    }
+    busyUntil_ = now + ms;
+    return {type, pwm, ms};
+}
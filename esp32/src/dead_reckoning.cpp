@@ -0,0 +1,164 @@
+/**
+ * 航位推算实现，见 dead_reckoning.h
+ */
+
+#include "dead_reckoning.h"
+
+// 与 STM32 固件的时长限制一致
+#define DR_MIN_MS   50
+#define DR_MAX_MS   3000
+
+bool DeadReckoning::begin() {
+    size_t cap = DR_CRUMB_CAPACITY;
+    crumbs_ = psramFound() ? (Breadcrumb*)ps_malloc(cap * sizeof(Breadcrumb)) : nullptr;
+    if (!crumbs_) {
+        cap = DR_CRUMB_FALLBACK;
+        crumbs_ = (Breadcrumb*)malloc(cap * sizeof(Breadcrumb));
+    }
+    crumbCap_ = crumbs_ ? cap : 0;
+    clearCrumbs();
+    return crumbs_ != nullptr;
+}
+
+void DeadReckoning::onMotion(char dir, uint8_t pwm, uint16_t ms, unsigned long now) {
+    update(now);
+    queueCount_ = 0;
+    Segment seg = {dir, pwm, ms};
+    start(seg, now);
+}
+
+void DeadReckoning::onVelocity(int8_t left, int8_t right, uint16_t deadmanMs, unsigned long now) {
+    update(now);
+    queueCount_ = 0;
+    Segment seg = {'V', 0, deadmanMs, left, right};
+    start(seg, now);
+}
+
+void DeadReckoning::onSegments(const char* seq, unsigned long now) {
+    update(now);
+    const char* p = seq;
+    while (*p) {
+        Segment seg = {};
+        char* end;
+        seg.dir = *p++;
+        seg.ms = (uint16_t)strtoul(p, &end, 10);
+        p = end;
+        if (*p == '@') {
+            seg.pwm = (uint8_t)strtoul(p + 1, &end, 10);
+            p = end;
+        }
+        if (*p == ',') p++;
+        if (!strchr("FBLRS", seg.dir) || queueCount_ >= DR_SEG_QUEUE) break;
+
+        if (!active_) {
+            start(seg, now);
+        } else {
+            queue_[(queueHead_ + queueCount_) % DR_SEG_QUEUE] = seg;
+            queueCount_++;
+        }
+    }
+}
+
+void DeadReckoning::onStop(unsigned long now) {
+    update(now);
+    active_ = false;
+    queueCount_ = 0;
+}
+
+void DeadReckoning::start(const Segment& seg, unsigned long at) {
+    current_ = seg;
+    if (current_.pwm == 0 || current_.pwm > 100) current_.pwm = DR_DEFAULT_PWM;
+    if (current_.ms < DR_MIN_MS) current_.ms = DR_MIN_MS;
+    if (current_.ms > DR_MAX_MS) current_.ms = DR_MAX_MS;
+    startedAt_ = at;
+    appliedMs_ = 0;
+    active_ = true;
+}
+
+void DeadReckoning::update(unsigned long now) {
+    while (active_) {
+        uint32_t elapsed = now - startedAt_;
+        uint32_t upto = elapsed < current_.ms ? elapsed : current_.ms;
+        if (upto > appliedMs_) {
+            integrate(current_, upto - appliedMs_);
+            appliedMs_ = upto;
+        }
+        if (elapsed < current_.ms) break;
+
+        // 下一段在上一段结束的时刻接上（STM32 段间无停顿）
+        unsigned long endAt = startedAt_ + current_.ms;
+        if (queueCount_ > 0) {
+            Segment next = queue_[queueHead_];
+            queueHead_ = (queueHead_ + 1) % DR_SEG_QUEUE;
+            queueCount_--;
+            start(next, endAt);
+        } else {
+            active_ = false;
+        }
+    }
+
+    if (recording_ && crumbCap_ > 0 &&
+        hypotf(pose_.x - lastCrumbX_, pose_.y - lastCrumbY_) >= DR_CRUMB_SPACING_MM) {
+        dropCrumb();
+    }
+}
+
+// 速度与 PWM 近似成正比；按本段中点航向积分
+void DeadReckoning::integrate(const Segment& seg, uint32_t ms) {
+    float t = ms / 1000.0f;
+    float scale = (float)seg.pwm / DR_DEFAULT_PWM;
+    float ds = 0, dth = 0;
+
+    switch (seg.dir) {
+        case 'F': ds = DR_SPEED_F_MM_S * scale * t; break;
+        case 'B': ds = -DR_SPEED_B_MM_S * scale * t; break;
+        case 'L': dth = radians(DR_TURN_L_DEG_S) * scale * t; break;
+        case 'R': dth = -radians(DR_TURN_R_DEG_S) * scale * t; break;
+        case 'V': {
+            // 差速：轮速按前进/后退标定值和 PWM 比例估计
+            float vl = seg.left * (float)(seg.left >= 0 ? DR_SPEED_F_MM_S : DR_SPEED_B_MM_S) / DR_DEFAULT_PWM;
+            float vr = seg.right * (float)(seg.right >= 0 ? DR_SPEED_F_MM_S : DR_SPEED_B_MM_S) / DR_DEFAULT_PWM;
+            ds = (vl + vr) * 0.5f * t;
+            dth = (vr - vl) / DR_WHEEL_BASE_MM * t;
+            break;
+        }
+        default: return;
+    }
+    // 单轮转向：另一只轮子不动，车体中心沿弧线前移
+    if (dth != 0 && seg.dir != 'V') ds = fabsf(dth) * DR_WHEEL_BASE_MM * 0.5f;
+
+    float mid = pose_.heading + dth * 0.5f;
+    pose_.x += ds * cosf(mid);
+    pose_.y += ds * sinf(mid);
+    pose_.heading += dth;
+    if (pose_.heading > PI) pose_.heading -= 2 * PI;
+    else if (pose_.heading <= -PI) pose_.heading += 2 * PI;
+}
+
+void DeadReckoning::dropCrumb() {
+    crumbs_[crumbHead_] = {(int16_t)lroundf(pose_.x / 10), (int16_t)lroundf(pose_.y / 10)};
+    crumbHead_ = (crumbHead_ + 1) % crumbCap_;
+    if (crumbCount_ < crumbCap_) crumbCount_++;
+    lastCrumbX_ = pose_.x;
+    lastCrumbY_ = pose_.y;
+}
+
+bool DeadReckoning::peekCrumb(Breadcrumb* out) const {
+    if (crumbCount_ == 0) return false;
+    *out = crumbs_[(crumbHead_ + crumbCap_ - 1) % crumbCap_];
+    return true;
+}
+
+void DeadReckoning::popCrumb() {
+    if (crumbCount_ == 0) return;
+    crumbHead_ = (crumbHead_ + crumbCap_ - 1) % crumbCap_;
+    crumbCount_--;
+}
+
+// 从当前位置重新开始记录
+void DeadReckoning::clearCrumbs() {
+    crumbHead_ = 0;
+    crumbCount_ = 0;
+    lastCrumbX_ = pose_.x;
+    lastCrumbY_ = pose_.y;
+}
@@ -18,6 +18,16 @@
 #include <HTTPClient.h>
 #include <DNSServer.h>
 #include <Preferences.h>
+#include <esp_timer.h>
+#include "avoidance.h"
+#include "control.h"
+#include "dead_reckoning.h"
+#include "metrics.h"
+#include "sensor_parse.h"
+#include "stm32_link.h"
+#include "telemetry_log.h"
+#include "telemetry_ws.h"
+#include "web_pages.h"
 
 // ============ 配置 ============
 #define LED_PIN 48
@@ -45,10 +55,44 @@
 #define STM32_RX 5
 #define STM32_BAUD 115200
 
-// 运动协议配置（选择与STM32固件匹配的协议）
-// "simple" = simo_robot_simple固件: F,<ms> / B,<ms> / L,<ms> / R,<ms> / S
-// "m-v1"   = simo_robot固件: M,forward,speed,duration / S
-#define MOTION_PROTOCOL "simple"
+// 运动协议配置（选择与STM32固件匹配的协议，编码策略见 stm32_cmd.h）
+// SimpleProtocol   = simo_robot_simple固件: F,<ms> / B,<ms> / L,<ms> / R,<ms> / S
+// MotionV1Protocol = simo_robot固件: M,forward,speed,duration / S
+#define MOTION_PROTOCOL SimpleProtocol
+
+// 二进制帧协议（COBS + CRC16，见 docs/stm32-binary-protocol.md）
+// 1 = STM32 连接后发送 BIN 协商，固件不支持时自动保持文本协议
+#define STM32_BINARY_PROTOCOL 1
+
+// 传感器流（STM32 定时主动上报 SENSOR，见 simo_full 的 STREAM 命令）
+// 0 = 不开启，每秒轮询一次；固件不支持时也退回轮询
+#define STM32_STREAM_HZ      20
+#define SENSOR_STALE_MS      500     // 超过该时间没有传感器数据视为流已中断
+#define PATROL_POLL_MS       100     // 巡逻时没有传感器流则按该间隔轮询
+#define IR_OBS_ACTIVE        0       // 红外避障模块检测到障碍时的输出电平（常见模块低电平有效）
+
+// 速度模式（网页摇杆 20~50Hz 发送 V,<左>,<右>，只有 simo_full 支持）
+// STM32 超过看门狗时间没有新设定值自行停车；与 simo_full 的 DEADMAN 默认值一致，航位推算用
+#define VELOCITY_DEADMAN_MS  300
+
+// 返航（航位推算，标定参数见 dead_reckoning.h）
+#define RETURN_ARRIVE_MM     150     // 离路点/原点小于该距离视为到达
+#define RETURN_HEADING_TOL   10      // 航向误差小于该角度（度）直接前进
+#define RETURN_MAX_MOVE_MS   1500    // 单条前进命令最长时间，之后重新对准
+#define RETURN_SETTLE_MS     150     // 命令结束后等待斜坡停稳再发下一条
+#define RETURN_OBSTACLE_MM   250     // 前方障碍距离（lastDistance 单位 0.1cm 即 mm）
+
+// 任务划分（ESP32-S3 双核）
+// core 0: 网络任务（WebServer、后端注册、OTA）
+// core 1: 控制任务（STM32 链路、传感器、自主导航），esp_timer 定时唤醒
+#define NET_TASK_CORE        0
+#define CONTROL_TASK_CORE    1
+#define NET_TASK_STACK       8192
+#define CONTROL_TASK_STACK   4096
+#define NET_TASK_PRIORITY    2
+#define CONTROL_TASK_PRIORITY 5
+#define CONTROL_PERIOD_US    10000   // 控制周期 10ms（100Hz）
+#define TICK_STATS_WINDOW_MS 10000   // 抖动统计窗口
 
 // 版本信息
 #define FIRMWARE_VERSION "2.4.1"
@@ -57,12 +101,20 @@
 // ============ 全局变量 ============
 WebServer server(80);
 HardwareSerial stm32Serial(1);  // UART1
+Stm32Link stm32Link;            // 非阻塞收发 + 应答分发
+DeadReckoning deadReckoning;    // 按已发出的运动命令估计位姿，记录返航路点
+TelemetryLog telemetryLog;      // 遥测历史（PSRAM），/telemetry 下载
 
 // 状态变量
 bool stm32Connected = false;
 unsigned long lastStm32Ping = 0;
 unsigned long lastSensorRead = 0;
+unsigned long lastSensorUpdate = 0;          // 最近一次收到 SENSOR 的时间
+uint32_t lastSensorStamp = 0;                // STM32 采样时间（ms，0=未知）
+unsigned long lastStreamRequest = 0;
+bool streamUnsupported = false;              // STREAM 回复 ERR
 int lastDistance = 0;
+bool lastDistanceValid = true;               // 低置信度的距离不参与避障
 bool leftIR = false, rightIR = false;      // 红外避障
 bool leftTrack = false, rightTrack = false; // 红外循迹
 
@@ -82,20 +134,30 @@ unsigned long lastOTACheck = 0;
 bool otaUpdateAvailable = false;
 String latestVersion = "";
 
-// 自主导航状态
-enum RobotMode {
-    MODE_IDLE = 0,      // 空闲
-    MODE_MANUAL = 1,    // 手动控制
-    MODE_PATROL = 2,    // 自主巡逻
-    MODE_FOLLOW = 3,    // 跟随模式
-    MODE_RETURN = 4     // 返航
-};
+// 自主导航状态（RobotMode 定义见 control.h）
 RobotMode currentMode = MODE_IDLE;
-unsigned long lastPatrolAction = 0;
-int patrolState = 0;  // 巡逻状态机
+AvoidanceEngine avoidance;       // 巡逻避障，每个新传感器样本决策一次
+uint32_t sensorSamples = 0;      // 收到的传感器样本数（SENSOR 回复/传感器帧）
+uint32_t sensorRejects = 0;      // 格式错误被丢弃的 SENSOR 行
+uint32_t patrolSeenSamples = 0;  // 避障引擎已处理到的样本
+unsigned long returnNextAt = 0;  // 返航：下一条命令的最早发送时间
+bool returnBlocked = false;      // 返航：前方有障碍，已停车等待
+
+// 任务间通信（类型定义见 control.h）
+ControlQueue netToControl;
+ControlQueue wsToControl;
+Seqlock<ControlStatus> controlStatus;
+
+TaskHandle_t controlTaskHandle = nullptr;
+TickStats lastTickStats = {};
 
 // 函数前向声明
-void sendToSTM32(const char* cmd, int speed = 150, int duration = 500);
+void sendToSTM32(Stm32Cmd cmd, int speed = 150, int arg = 500);
+void sendTextToSTM32(const char* text);
+void recordMotion(Stm32Cmd cmd, int pwm, int duration);
+void recordTextCommand(const char* text);
+void runReturnHome(unsigned long now);
+void runPatrol(unsigned long now);
 void runAutonomousLogic();
 void startProvisioningMode();
 void loadWiFiCredentials();
@@ -103,398 +165,143 @@ void saveWiFiCredentials(const String& ssid, const String& password);
 void registerToBackend();
 void checkOTAUpdate();
 void performOTAUpdate(const String& url);
-
-// ============ HTML 页面 - 高度集成控制面板 ============
-const char* htmlPage = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0, user-scalable=no">
-    <title>Simo</title>
-    <style>
-        :root { --accent: #00d9ff; --bg: #0d1117; --card: #161b22; --border: #30363d; }
-        * { box-sizing: border-box; margin: 0; padding: 0; }
-        body { font-family: -apple-system, system-ui, sans-serif; background: var(--bg); color: #e6edf3; min-height: 100vh; }
-        
-        /* 顶部状态栏 */
-        .header { background: var(--card); padding: 12px 16px; display: flex; justify-content: space-between; align-items: center; border-bottom: 1px solid var(--border); position: sticky; top: 0; z-index: 100; }
-        .logo { font-size: 20px; font-weight: 600; }
-        .logo span { color: var(--accent); }
-        .status-dots { display: flex; gap: 8px; }
-        .dot { width: 10px; height: 10px; border-radius: 50%; background: #484f58; }
-        .dot.on { background: #3fb950; }
-        .dot.warn { background: #d29922; }
-        
-        /* 主内容区 */
-        .main { padding: 16px; max-width: 500px; margin: 0 auto; }
-        
-        /* 卡片 */
-        .card { background: var(--card); border: 1px solid var(--border); border-radius: 12px; padding: 16px; margin-bottom: 16px; }
-        .card-title { font-size: 14px; color: #8b949e; margin-bottom: 12px; display: flex; align-items: center; gap: 8px; }
-        
-        /* 控制面板 */
-        .controls { display: grid; grid-template-columns: repeat(3, 1fr); gap: 8px; max-width: 240px; margin: 0 auto; }
-        .ctrl-btn { height: 70px; border: none; border-radius: 12px; font-size: 24px; cursor: pointer; background: #21262d; color: var(--accent); transition: all 0.15s; }
-        .ctrl-btn:active { transform: scale(0.95); background: #30363d; }
-        .ctrl-btn.stop { background: #b62324; color: #fff; }
-        .ctrl-btn.empty { visibility: hidden; }
-        
-        /* 模式选择 */
-        .modes { display: flex; gap: 8px; flex-wrap: wrap; }
-        .mode-btn { flex: 1; min-width: 80px; padding: 12px 8px; border: 1px solid var(--border); border-radius: 8px; background: transparent; color: #8b949e; font-size: 12px; cursor: pointer; transition: all 0.15s; }
-        .mode-btn.active { border-color: var(--accent); color: var(--accent); background: rgba(0,217,255,0.1); }
-        
-        /* WiFi配置 */
-        .wifi-form { display: flex; flex-direction: column; gap: 12px; }
-        .input-group { display: flex; gap: 8px; }
-        .input-group input, .input-group select { flex: 1; padding: 10px 12px; border: 1px solid var(--border); border-radius: 8px; background: #0d1117; color: #e6edf3; font-size: 14px; }
-        .input-group input:focus { outline: none; border-color: var(--accent); }
-        .btn { padding: 12px 20px; border: none; border-radius: 8px; font-size: 14px; cursor: pointer; transition: all 0.15s; }
-        .btn-primary { background: var(--accent); color: #000; font-weight: 500; }
-        .btn-secondary { background: #21262d; color: #e6edf3; }
-        .btn-danger { background: #b62324; color: #fff; }
-        .btn:active { transform: scale(0.98); }
-        
-        /* WiFi列表 */
-        .wifi-list { max-height: 150px; overflow-y: auto; margin-bottom: 12px; }
-        .wifi-item { padding: 10px 12px; border-radius: 6px; cursor: pointer; display: flex; justify-content: space-between; }
-        .wifi-item:hover { background: #21262d; }
-        .wifi-rssi { color: #8b949e; font-size: 12px; }
-        
-        /* 系统信息 */
-        .info-grid { display: grid; grid-template-columns: repeat(2, 1fr); gap: 8px; }
-        .info-item { background: #0d1117; padding: 10px; border-radius: 8px; }
-        .info-label { font-size: 11px; color: #8b949e; }
-        .info-value { font-size: 14px; margin-top: 2px; }
-        
-        /* OTA升级 */
-        .ota-section { text-align: center; }
-        .version { font-size: 24px; font-weight: 600; color: var(--accent); }
-        .ota-status { font-size: 12px; color: #8b949e; margin: 8px 0; }
-        input[type="file"] { display: none; }
-        .file-label { display: inline-block; padding: 12px 24px; background: #21262d; border-radius: 8px; cursor: pointer; }
-        .progress { height: 4px; background: #21262d; border-radius: 2px; margin-top: 12px; overflow: hidden; display: none; }
-        .progress-bar { height: 100%; background: var(--accent); width: 0%; transition: width 0.3s; }
-        
-        /* 折叠面板 */
-        .collapse-header { cursor: pointer; display: flex; justify-content: space-between; align-items: center; }
-        .collapse-content { display: none; margin-top: 12px; }
-        .collapse-content.show { display: block; }
-        .arrow { transition: transform 0.2s; }
-        .arrow.open { transform: rotate(180deg); }
-        
-        /* 底部导航 */
-        .nav { position: fixed; bottom: 0; left: 0; right: 0; background: var(--card); border-top: 1px solid var(--border); display: flex; padding: 8px 0; }
-        .nav-item { flex: 1; text-align: center; padding: 8px; color: #8b949e; font-size: 11px; cursor: pointer; }
-        .nav-item.active { color: var(--accent); }
-        .nav-icon { font-size: 20px; margin-bottom: 2px; }
-        
-        /* 页面切换 */
-        .page { display: none; padding-bottom: 70px; }
-        .page.active { display: block; }
-        
-        /* 消息提示 */
-        .toast { position: fixed; top: 60px; left: 50%; transform: translateX(-50%); background: var(--card); border: 1px solid var(--border); padding: 12px 20px; border-radius: 8px; z-index: 200; display: none; }
-    </style>
-</head>
-<body>
-    <!-- 顶部状态栏 -->
-    <div class="header">
-        <div class="logo">🤖 <span>Simo</span></div>
-        <div class="status-dots">
-            <div class="dot" id="dotWifi" title="WiFi"></div>
-            <div class="dot" id="dotStm32" title="STM32"></div>
-        </div>
-    </div>
-    
-    <!-- 控制页 -->
-    <div class="page active" id="pageControl">
-        <div class="main">
-            <!-- 方向控制 -->
-            <div class="card">
-                <div class="card-title">⬆️ 运动控制</div>
-                <div class="controls">
-                    <div class="ctrl-btn empty"></div>
-                    <button class="ctrl-btn" ontouchstart="cmd('F')" onmousedown="cmd('F')">↑</button>
-                    <div class="ctrl-btn empty"></div>
-                    <button class="ctrl-btn" ontouchstart="cmd('L')" onmousedown="cmd('L')">←</button>
-                    <button class="ctrl-btn stop" ontouchstart="cmd('S')" onmousedown="cmd('S')">■</button>
-                    <button class="ctrl-btn" ontouchstart="cmd('R')" onmousedown="cmd('R')">→</button>
-                    <div class="ctrl-btn empty"></div>
-                    <button class="ctrl-btn" ontouchstart="cmd('B')" onmousedown="cmd('B')">↓</button>
-                    <div class="ctrl-btn empty"></div>
-                </div>
-            </div>
-            
-            <!-- 模式选择 -->
-            <div class="card">
-                <div class="card-title">🎯 运行模式</div>
-                <div class="modes">
-                    <button class="mode-btn active" data-mode="idle" onclick="setMode('idle')">空闲</button>
-                    <button class="mode-btn" data-mode="manual" onclick="setMode('manual')">手动</button>
-                    <button class="mode-btn" data-mode="patrol" onclick="setMode('patrol')">巡逻</button>
-                    <button class="mode-btn" data-mode="follow" onclick="setMode('follow')">跟随</button>
-                </div>
-            </div>
-            
-            <!-- 语音命令 -->
-            <div class="card">
-                <div class="card-title">🎤 语音命令</div>
-                <div class="input-group">
-                    <input type="text" id="voiceInput" placeholder="输入命令，如：前进、巡逻...">
-                    <button class="btn btn-primary" onclick="sendVoice()">发送</button>
-                </div>
-            </div>
-        </div>
-    </div>
-    
-    <!-- 设置页 -->
-    <div class="page" id="pageSettings">
-        <div class="main">
-            <!-- WiFi配置 -->
-            <div class="card">
-                <div class="collapse-header" onclick="toggleCollapse('wifiSection')">
-                    <div class="card-title" style="margin:0">📶 WiFi配置</div>
-                    <span class="arrow" id="arrowWifi">▼</span>
-                </div>
-                <div class="collapse-content show" id="wifiSection">
-                    <button class="btn btn-secondary" style="width:100%;margin-bottom:12px" onclick="scanWifi()">扫描网络</button>
-                    <div class="wifi-list" id="wifiList"></div>
-                    <div class="wifi-form">
-                        <input type="text" id="ssidInput" placeholder="WiFi名称">
-                        <input type="password" id="passInput" placeholder="WiFi密码">
-                        <div style="display:flex;gap:8px">
-                            <button class="btn btn-primary" style="flex:1" onclick="saveWifi()">保存并连接</button>
-                            <button class="btn btn-danger" onclick="clearWifi()">清除</button>
-                        </div>
-                    </div>
-                </div>
-            </div>
-            
-            <!-- OTA升级 -->
-            <div class="card">
-                <div class="collapse-header" onclick="toggleCollapse('otaSection')">
-                    <div class="card-title" style="margin:0">⬆️ 固件升级</div>
-                    <span class="arrow" id="arrowOta">▼</span>
-                </div>
-                <div class="collapse-content show" id="otaSection">
-                    <div class="ota-section">
-                        <div class="version" id="fwVersion">--</div>
-                        <div class="ota-status" id="otaStatus">当前版本</div>
-                        <label class="file-label">
-                            选择固件文件
-                            <input type="file" id="fwFile" accept=".bin" onchange="uploadFirmware()">
-                        </label>
-                        <div class="progress" id="otaProgress">
-                            <div class="progress-bar" id="otaBar"></div>
-                        </div>
-                    </div>
-                </div>
-            </div>
-            
-            <!-- 系统信息 -->
-            <div class="card">
-                <div class="card-title">ℹ️ 系统信息</div>
-                <div class="info-grid">
-                    <div class="info-item"><div class="info-label">芯片</div><div class="info-value" id="infoChip">--</div></div>
-                    <div class="info-item"><div class="info-label">内存</div><div class="info-value" id="infoHeap">--</div></div>
-                    <div class="info-item"><div class="info-label">AP IP</div><div class="info-value" id="infoApIp">--</div></div>
-                    <div class="info-item"><div class="info-label">局域网IP</div><div class="info-value" id="infoStaIp">--</div></div>
-                    <div class="info-item"><div class="info-label">运行时间</div><div class="info-value" id="infoUptime">--</div></div>
-                    <div class="info-item"><div class="info-label">距离</div><div class="info-value" id="infoDist">--</div></div>
-                </div>
-            </div>
-        </div>
-    </div>
-    
-    <!-- 底部导航 -->
-    <div class="nav">
-        <div class="nav-item active" onclick="showPage('pageControl')">
-            <div class="nav-icon">🎮</div>控制
-        </div>
-        <div class="nav-item" onclick="showPage('pageSettings')">
-            <div class="nav-icon">⚙️</div>设置
-        </div>
-    </div>
-    
-    <!-- 消息提示 -->
-    <div class="toast" id="toast"></div>
-    
-    <script>
-        // 页面切换
-        function showPage(id) {
-            document.querySelectorAll('.page').forEach(p => p.classList.remove('active'));
-            document.querySelectorAll('.nav-item').forEach(n => n.classList.remove('active'));
-            document.getElementById(id).classList.add('active');
-            event.currentTarget.classList.add('active');
-        }
-        
-        // 折叠面板
-        function toggleCollapse(id) {
-            const el = document.getElementById(id);
-            el.classList.toggle('show');
-        }
-        
-        // 消息提示
-        function toast(msg) {
-            const t = document.getElementById('toast');
-            t.innerText = msg;
-            t.style.display = 'block';
-            setTimeout(() => t.style.display = 'none', 2000);
-        }
-        
-        // 运动命令
-        function cmd(c) {
-            fetch('/cmd?c=' + c).then(r => r.text()).then(t => toast(t));
-        }
-        
-        // 模式切换
-        function setMode(m) {
-            fetch('/mode?m=' + m).then(r => r.text()).then(t => {
-                document.querySelectorAll('.mode-btn').forEach(b => b.classList.remove('active'));
-                document.querySelector('[data-mode="'+m+'"]').classList.add('active');
-                toast(t);
-            });
-        }
-        
-        // 语音命令
-        function sendVoice() {
-            const text = document.getElementById('voiceInput').value;
-            if (!text) return;
-            fetch('/voice?text=' + encodeURIComponent(text)).then(r => r.text()).then(t => {
-                toast(t);
-                document.getElementById('voiceInput').value = '';
-            });
-        }
-        
-        // WiFi扫描
-        function scanWifi() {
-            toast('扫描中...');
-            fetch('/wifi/scan').then(r => r.json()).then(data => {
-                let html = '';
-                data.forEach(n => {
-                    html += '<div class="wifi-item" onclick="selectWifi(\'' + n.ssid + '\')"><span>' + n.ssid + '</span><span class="wifi-rssi">' + n.rssi + 'dBm</span></div>';
-                });
-                document.getElementById('wifiList').innerHTML = html;
-                toast('找到 ' + data.length + ' 个网络');
-            });
-        }
-        
-        function selectWifi(ssid) {
-            document.getElementById('ssidInput').value = ssid;
-        }
-        
-        // 保存WiFi
-        function saveWifi() {
-            const ssid = document.getElementById('ssidInput').value;
-            const pass = document.getElementById('passInput').value;
-            if (!ssid) { toast('请输入WiFi名称'); return; }
-            toast('正在连接...');
-            fetch('/wifi/save', { method: 'POST', body: new URLSearchParams({ssid: ssid, password: pass}) })
-                .then(r => r.text()).then(t => { toast(t.includes('成功') ? '连接成功!' : '连接失败'); setTimeout(() => location.reload(), 2000); });
-        }
-        
-        // 清除WiFi
-        function clearWifi() {
-            if (confirm('确定清除WiFi配置？')) {
-                fetch('/wifi/clear').then(() => toast('已清除，重启中...'));
-            }
-        }
-        
-        // OTA升级
-        function uploadFirmware() {
-            const file = document.getElementById('fwFile').files[0];
-            if (!file) return;
-            const form = new FormData();
-            form.append('update', file);
-            document.getElementById('otaProgress').style.display = 'block';
-            document.getElementById('otaStatus').innerText = '升级中...';
-            const xhr = new XMLHttpRequest();
-            xhr.upload.onprogress = e => {
-                if (e.lengthComputable) {
-                    document.getElementById('otaBar').style.width = (e.loaded / e.total * 100) + '%';
-                }
-            };
-            xhr.onload = () => {
-                document.getElementById('otaStatus').innerText = '升级成功，重启中...';
-                setTimeout(() => location.reload(), 3000);
-            };
-            xhr.open('POST', '/update');
-            xhr.send(form);
-        }
-        
-        // 刷新状态
-        function refreshStatus() {
-            fetch('/status').then(r => r.json()).then(d => {
-                document.getElementById('dotStm32').className = 'dot ' + (d.stm32 ? 'on' : '');
-                document.getElementById('infoDist').innerText = d.distance + 'cm';
-                document.getElementById('infoUptime').innerText = Math.floor(d.uptime / 60) + '分';
-                document.getElementById('infoHeap').innerText = Math.round(d.heap / 1024) + 'KB';
-                document.getElementById('fwVersion').innerText = 'v' + d.version;
-                document.querySelectorAll('.mode-btn').forEach(b => b.classList.remove('active'));
-                const modeBtn = document.querySelector('[data-mode="'+d.mode+'"]');
-                if (modeBtn) modeBtn.classList.add('active');
-            }).catch(() => {});
-            fetch('/info').then(r => r.json()).then(d => {
-                document.getElementById('infoChip').innerText = d.chip;
-                document.getElementById('infoApIp').innerText = d.ip;
-                document.getElementById('dotWifi').className = 'dot on';
-            }).catch(() => {});
-        }
-        
-        refreshStatus();
-        setInterval(refreshStatus, 5000);
-    </script>
-</body>
-</html>
-)rawliteral";
+void applySensor(const SensorSnapshot& s);
+bool postMotion(Stm32Cmd cmd, int speed = 150, int duration = 500);
+bool postText(const char* text);
+bool postVelocity(int8_t left, int8_t right);
+bool postMode(RobotMode mode);
+void startTasks();
+void onStm32Ack(const char* cmd, const char* line, size_t len, uint32_t rttMs);
+void onStm32Sensor(const char* line, size_t len);
+void onStm32SensorData(uint16_t distance, uint8_t flags, uint32_t stampMs);
+void onStm32Pong(bool ok, uint32_t rttMs);
+void onStm32Unsolicited(const char* line, size_t len);
 
 // ============ 处理函数 ============
+// 预压缩页面（web_pages.h）：ETag 与浏览器缓存一致时回 304，
+// 否则直接从 flash 分块发送 gzip 数据，不复制到堆
+void sendPage(const WebPage& page) {
+    server.sendHeader("ETag", page.etag);
+    server.sendHeader("Cache-Control", "no-cache");    // 每次都带 If-None-Match 验证
+    if (server.header("If-None-Match") == page.etag) {
+        server.send(304);
+        return;
+    }
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, page.type, (const char*)page.gz, page.len);
+}
+
 void handleRoot() {
-    server.send(200, "text/html", htmlPage);
+    sendPage(WEB_INDEX);
 }
 
-// STM32 命令映射（根据 MOTION_PROTOCOL 配置选择协议格式）
-void sendToSTM32(const char* cmd, int speed, int duration) {
-    char buffer[64];
-    const char* protocol = MOTION_PROTOCOL;
+// 二进制协议下的命令映射（运动/停止/查询走紧凑帧，STREAM 包成 TEXT 帧）
+void sendToSTM32Binary(Stm32Cmd cmd, int speed, int arg) {
+    char buffer[STM32_CMD_MAX_LEN];
+    bool ok;
+    // pwm 0 表示使用 STM32 固件默认速度
+    uint8_t pwm = speed >= 0 && speed <= 100 ? speed : 0;
     
-    // 停止命令：两种协议都是 S
-    if (strcmp(cmd, "S") == 0) {
-        snprintf(buffer, sizeof(buffer), "S\n");
+    if (cmd == CMD_STOP) {
+        ok = stm32Link.sendFrame(FRAME_STOP, nullptr, 0, "S");
+    } else if (cmd == CMD_PING) {
+        stm32Link.ping();
+        return;
+    } else if (cmd == CMD_SENSOR) {
+        ok = stm32Link.sendFrame(FRAME_SENSOR_REQ, nullptr, 0, "SENSOR", false);
+    } else if (cmd == CMD_VELOCITY) {
+        uint8_t vel[2] = {(uint8_t)stm32cmd::clampVel(speed), (uint8_t)stm32cmd::clampVel(arg)};
+        ok = stm32Link.sendFrame(FRAME_VEL, vel, sizeof(vel), "V");
+    } else if (stm32CmdIsMove(cmd)) {
+        uint16_t ms = stm32cmd::clampU16(arg);
+        char tag[2] = {stm32CmdLetter(cmd), '\0'};
+        uint8_t move[4] = {(uint8_t)tag[0], pwm, (uint8_t)(ms & 0xFF), (uint8_t)(ms >> 8)};
+        ok = stm32Link.sendFrame(FRAME_MOVE, move, sizeof(move), tag);
+    } else {
+        encodeStm32Cmd<MOTION_PROTOCOL>(buffer, cmd, speed, arg);
+        ok = stm32Link.send(buffer);
     }
-    // 心跳检测
-    else if (strcmp(cmd, "PING") == 0) {
-        snprintf(buffer, sizeof(buffer), "PING\n");
+    
+    if (!ok) {
+        encodeStm32Cmd<MOTION_PROTOCOL>(buffer, cmd, speed, arg);
+        Serial.printf("[->STM32] 链路忙，丢弃: %s", buffer);
+        return;
     }
-    // 传感器查询
-    else if (strcmp(cmd, "SENSOR") == 0) {
-        snprintf(buffer, sizeof(buffer), "SENSOR\n");
+    recordMotion(cmd, cmd == CMD_VELOCITY ? speed : pwm, arg);
+}
+
+// STM32 命令发送（文本格式由 MOTION_PROTOCOL 在编译期决定）
+void sendToSTM32(Stm32Cmd cmd, int speed, int arg) {
+    char buffer[STM32_CMD_MAX_LEN];
+    
+    if (stm32Link.binary()) {
+        sendToSTM32Binary(cmd, speed, arg);
+        return;
     }
-    // 运动命令：根据协议选择格式
-    else if (strcmp(cmd, "F") == 0 || strcmp(cmd, "B") == 0 || 
-             strcmp(cmd, "L") == 0 || strcmp(cmd, "R") == 0) {
-        if (strcmp(protocol, "simple") == 0) {
-            // simple协议: F,<ms> / B,<ms> / L,<ms> / R,<ms>
-            snprintf(buffer, sizeof(buffer), "%s,%d\n", cmd, duration);
-        } else {
-            // m-v1协议: M,forward,speed,duration
-            const char* dirName = "forward";
-            if (strcmp(cmd, "B") == 0) dirName = "backward";
-            else if (strcmp(cmd, "L") == 0) dirName = "left";
-            else if (strcmp(cmd, "R") == 0) dirName = "right";
-            float speedFloat = speed / 100.0f;
-            snprintf(buffer, sizeof(buffer), "M,%s,%.2f,%d\n", dirName, speedFloat, duration);
-        }
+    
+    encodeStm32Cmd<MOTION_PROTOCOL>(buffer, cmd, speed, arg);
+    // simo_robot_simple 执行完运动才回复 OK，应答超时从执行完算起
+    if (!stm32Link.send(buffer, stm32CmdIsMove(cmd) ? stm32cmd::clampU16(arg) : 0)) {
+        Serial.printf("[->STM32] 链路忙，丢弃: %s", buffer);
+        return;
     }
-    // 其他命令：直接发送
-    else {
-        snprintf(buffer, sizeof(buffer), "%s\n", cmd);
+    // 设定值流每秒几十条，不逐条打印
+    if (cmd != CMD_VELOCITY) Serial.printf("[->STM32] %s", buffer);
+    recordMotion(cmd, cmd == CMD_VELOCITY ? speed : MOTION_PROTOCOL::pwm(speed), arg);
+}
+
+// 透传命令（/cmd 的调试命令，如 BEEP、SA；二进制模式下包成 TEXT 帧）
+void sendTextToSTM32(const char* text) {
+    char buffer[STM32_CMD_MAX_LEN];
+    
+    if (!stm32TextCmdValid(text, sizeof(buffer) - 2)) {
+        Serial.printf("[->STM32] 非法命令，丢弃: %s\n", text);
+        return;
     }
+    size_t n = strlen(text);
+    memcpy(buffer, text, n);
+    buffer[n] = '\n';
+    buffer[n + 1] = '\0';
     
-    stm32Serial.print(buffer);
+    if (!stm32Link.send(buffer)) {
+        Serial.printf("[->STM32] 链路忙，丢弃: %s", buffer);
+        return;
+    }
     Serial.printf("[->STM32] %s", buffer);
+    recordTextCommand(text);
+}
+
+// 航位推算：记录已经发出的运动命令（pwm 0 或超出 0~100 按固件默认；
+// CMD_VELOCITY 时 pwm/duration 是左右轮设定值）
+void recordMotion(Stm32Cmd cmd, int pwm, int duration) {
+    unsigned long now = millis();
+    uint8_t p = pwm > 0 && pwm <= 100 ? pwm : 0;
+    
+    if (cmd == CMD_VELOCITY) {
+        int8_t left = stm32cmd::clampVel(pwm);
+        int8_t right = stm32cmd::clampVel(duration);
+        deadReckoning.onVelocity(left, right, VELOCITY_DEADMAN_MS, now);
+        telemetryLog.noteCommand('V', (uint8_t)(abs(left) > abs(right) ? abs(left) : abs(right)), 0);
+    } else if (cmd == CMD_STOP) {
+        deadReckoning.onStop(now);
+        telemetryLog.noteCommand('S', 0, 0);
+    } else if (stm32CmdIsMove(cmd)) {
+        uint16_t ms = stm32cmd::clampU16(duration);
+        deadReckoning.onMotion(stm32CmdLetter(cmd), p, ms, now);
+        telemetryLog.noteCommand(stm32CmdLetter(cmd), p, ms);
+    }
+}
+
+void recordTextCommand(const char* text) {
+    unsigned long now = millis();
+    
+    if (strcmp(text, "SA") == 0) {
+        deadReckoning.onStop(now);
+        telemetryLog.noteCommand('S', 0, 0);
+    } else if (strncmp(text, "SEQ,", 4) == 0) {
+        deadReckoning.onSegments(text + 4, now);
+        telemetryLog.noteCommand('Q', 0, 0);
+    }
 }
 
 void handleCmd() {
@@ -507,49 +314,183 @@ void handleCmd() {
     int duration = durationStr.length() > 0 ? durationStr.toInt() : 500;
     
     if (cmd.length() > 0) {
-        // 发送到 STM32（使用标准协议）
-        sendToSTM32(cmd.c_str(), speed, duration);
-        
-        // 等待 STM32 响应
-        unsigned long start = millis();
-        while (!stm32Serial.available() && millis() - start < 100) {
-            delay(10);
-        }
-        
-        if (stm32Serial.available()) {
-            response = stm32Serial.readStringUntil('\n');
-            response.trim();
+        // 交给控制任务发送，不等待应答；
+        // 应答由 stm32Link 异步匹配，结果见 /status 的 lastAck
+        Stm32Cmd c;
+        if (stm32CmdFromName(cmd.c_str(), cmd.length(), &c)) {
+            if (!postMotion(c, speed, duration)) response = "ERR,busy";
+        } else if (cmd.length() >= sizeof(ControlMsg::text)) {
+            response = "ERR,length";    // 不截断，整条拒绝
+        } else if (!stm32TextCmdValid(cmd.c_str(), sizeof(ControlMsg::text) - 1)) {
+            response = "ERR,cmd";
+        } else if (!postText(cmd.c_str())) {
+            response = "ERR,busy";
         }
     }
     
     server.send(200, "text/plain", response);
 }
 
+// 摇杆速度设定值：/vel?l=<左>&r=<右>（-100~100）；高频发送请用 WebSocket 的 V,<左>,<右>
+void handleVelocity() {
+    String arg = server.arg("l") + "," + server.arg("r");
+    int8_t left, right;
+    
+    if (!stm32ParseVelocity(arg.c_str(), &left, &right)) {
+        server.send(400, "text/plain", "ERR,range");
+        return;
+    }
+    server.send(200, "text/plain", postVelocity(left, right) ? "OK" : "ERR,busy");
+}
+
 void handleStatus() {
-    // 返回缓存的状态（避免频繁查询STM32）
-    const char* modeNames[] = {"idle", "manual", "patrol", "follow", "return"};
-    char json[512];
+    // 返回控制任务发布的快照（避免频繁查询STM32）
+    ControlStatus st = controlStatus.read();
+    char json[704];
     snprintf(json, sizeof(json),
-        "{\"stm32\":%s,\"distance\":%d,"
+        "{\"stm32\":%s,\"distance\":%d,\"distanceValid\":%s,"
         "\"leftIR\":%s,\"rightIR\":%s,"
         "\"leftTrack\":%s,\"rightTrack\":%s,"
         "\"mode\":\"%s\",\"modeId\":%d,"
+        "\"lastAck\":\"%s\",\"ackRtt\":%lu,\"ackTimeouts\":%lu,"
+        "\"tick\":{\"periodUs\":%d,\"count\":%lu,\"overruns\":%lu,"
+        "\"maxLateUs\":%ld,\"avgJitterUs\":%lu,\"maxWorkUs\":%lu},"
+        "\"pose\":{\"x\":%ld,\"y\":%ld,\"heading\":%d,\"crumbs\":%lu},"
+        "\"telemetry\":{\"records\":%lu,\"capacity\":%lu},"
         "\"heap\":%lu,\"uptime\":%lu,\"version\":\"%s\"}",
-        stm32Connected ? "true" : "false",
-        lastDistance,
-        leftIR ? "true" : "false",
-        rightIR ? "true" : "false",
-        leftTrack ? "true" : "false",
-        rightTrack ? "true" : "false",
-        modeNames[currentMode],
-        currentMode,
-        ESP.getFreeHeap(),
+        st.stm32Connected ? "true" : "false",
+        st.sensor.distance,
+        st.sensor.distanceValid ? "true" : "false",
+        st.sensor.leftIR ? "true" : "false",
+        st.sensor.rightIR ? "true" : "false",
+        st.sensor.leftTrack ? "true" : "false",
+        st.sensor.rightTrack ? "true" : "false",
+        robotModeName(st.mode),
+        st.mode,
+        st.lastAck,
+        (unsigned long)st.ackRtt,
+        (unsigned long)st.ackTimeouts,
+        CONTROL_PERIOD_US,
+        (unsigned long)st.tick.ticks,
+        (unsigned long)st.tick.overruns,
+        (long)st.tick.maxLateUs,
+        (unsigned long)st.tick.avgJitterUs,
+        (unsigned long)st.tick.maxWorkUs,
+        lroundf(st.pose.x),
+        lroundf(st.pose.y),
+        (int)lroundf(degrees(st.pose.heading)),
+        (unsigned long)st.crumbs,
+        (unsigned long)telemetryLog.size(),
+        (unsigned long)telemetryLog.capacity(),
+        (unsigned long)ESP.getFreeHeap(),
         millis() / 1000,
         FIRMWARE_VERSION
     );
     server.send(200, "application/json", json);
 }
 
+// 遥测历史下载
+// GET /telemetry?from=<ms>&to=<ms>&last=<s>&bucket=<ms>&format=csv|bin
+//   时间为 ESP32 的 millis()；不给 from 时取最近 last 秒（默认 600）；
+//   bucket=0 不降采样，默认 1000；format 默认 csv
+//   bin 格式：12 字节头（"STL1"、行长 u16、保留 u16、桶宽 u32），之后每行一个 TelemetryBucket
+void handleTelemetry() {
+    uint32_t now = millis();
+    uint32_t to = server.hasArg("to") ? strtoul(server.arg("to").c_str(), nullptr, 10) : now;
+    uint32_t last = server.hasArg("last") ? strtoul(server.arg("last").c_str(), nullptr, 10) : 600;
+    uint32_t from = server.hasArg("from") ? strtoul(server.arg("from").c_str(), nullptr, 10)
+                                          : (to > last * 1000 ? to - last * 1000 : 0);
+    uint32_t bucket = server.hasArg("bucket") ? strtoul(server.arg("bucket").c_str(), nullptr, 10) : 1000;
+    bool binary = server.arg("format") == "bin";
+    
+    if (telemetryLog.capacity() == 0) {
+        server.send(503, "text/plain", "ERR,no buffer");
+        return;
+    }
+    
+    TelemetryCursor cur = telemetryLog.seek(from, to, bucket);
+    TelemetryBucket rows[24];          // CSV 每行最长约 64 字节，一批正好装进 buf
+    size_t n;
+    
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    if (binary) {
+        uint8_t header[12] = {'S', 'T', 'L', '1', sizeof(TelemetryBucket), 0, 0, 0};
+        memcpy(header + 8, &bucket, 4);
+        server.send(200, "application/octet-stream", "");
+        server.sendContent((const char*)header, sizeof(header));
+        while ((n = telemetryLog.next(cur, rows, 24)) > 0) {
+            server.sendContent((const char*)rows, n * sizeof(TelemetryBucket));
+        }
+    } else {
+        char buf[1536];
+        server.send(200, "text/csv", "");
+        server.sendContent("ms,count,dist_min,dist_max,rtt_min,rtt_max,flags,mode,cmds,cmd,timeouts\n");
+        while ((n = telemetryLog.next(cur, rows, 24)) > 0) {
+            size_t len = 0;
+            for (size_t i = 0; i < n; i++) {
+                const TelemetryBucket& b = rows[i];
+                char cmd[2] = {b.cmd, '\0'};
+                len += snprintf(buf + len, sizeof(buf) - len, "%lu,%u,%u,%u,%u,%u,%u,%s,%u,%s,%u\n",
+                    (unsigned long)b.ms, b.count, b.distMin, b.distMax, b.rttMin, b.rttMax,
+                    b.flags, robotModeName((RobotMode)b.mode), b.cmds, cmd, b.timeouts);
+            }
+            server.sendContent(buf, len);
+        }
+    }
+    server.sendContent("");
+}
+
+// Prometheus 指标（metrics.h），分块发送
+class HttpMetricsSink : public MetricsSink {
+public:
+    void write(const char* s, size_t len) override {
+        if (len_ + len > sizeof(buf_)) flush();
+        if (len > sizeof(buf_)) {
+            server.sendContent(s, len);
+            return;
+        }
+        memcpy(buf_ + len_, s, len);
+        len_ += len;
+    }
+    void flush() {
+        if (len_) server.sendContent(buf_, len_);
+        len_ = 0;
+    }
+
+private:
+    char buf_[1024];
+    size_t len_ = 0;
+};
+
+void handleMetrics() {
+    HttpMetricsSink out;
+    // 控制任务的状态只从快照读取
+    ControlStatus st = controlStatus.read();
+    
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/plain; version=0.0.4", "");
+    metrics.render(out);
+    
+    out.printf("# TYPE simo_heap_free_bytes gauge\nsimo_heap_free_bytes %lu\n",
+               (unsigned long)ESP.getFreeHeap());
+    out.printf("# TYPE simo_heap_min_free_bytes gauge\nsimo_heap_min_free_bytes %lu\n",
+               (unsigned long)ESP.getMinFreeHeap());
+    out.printf("# TYPE simo_psram_free_bytes gauge\nsimo_psram_free_bytes %lu\n",
+               (unsigned long)ESP.getFreePsram());
+    out.printf("# TYPE simo_uptime_seconds gauge\nsimo_uptime_seconds %lu\n", millis() / 1000);
+    out.printf("# TYPE simo_stm32_connected gauge\nsimo_stm32_connected %d\n", st.stm32Connected ? 1 : 0);
+    out.printf("# TYPE simo_stm32_rx_overflows_total counter\nsimo_stm32_rx_overflows_total %lu\n",
+               (unsigned long)stm32Link.rxOverflows());
+    out.printf("# TYPE simo_stm32_frame_errors_total counter\nsimo_stm32_frame_errors_total %lu\n",
+               (unsigned long)st.frameErrors);
+    out.printf("# TYPE simo_stm32_sensor_rejects_total counter\nsimo_stm32_sensor_rejects_total %lu\n",
+               (unsigned long)st.sensorRejects);
+    out.printf("# TYPE simo_control_max_late_seconds gauge\nsimo_control_max_late_seconds %.6f\n",
+               abs(st.tick.maxLateUs) / 1e6);
+    out.flush();
+    server.sendContent("");
+}
+
 void handlePing() {
     server.send(200, "text/plain", "PONG");
 }
@@ -567,7 +508,7 @@ void handleInfo() {
         ESP.getCpuFreqMHz(),
         ESP.getFlashChipSize() / 1024 / 1024,
         ESP.getPsramSize() / 1024 / 1024,
-        ESP.getFreeHeap(),
+        (unsigned long)ESP.getFreeHeap(),
         FIRMWARE_VERSION,
         BUILD_DATE,
         WiFi.softAPIP().toString().c_str(),
@@ -578,49 +519,7 @@ void handleInfo() {
 
 // OTA远程升级页面
 void handleOTA() {
-    const char* otaPage = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>Simo OTA升级</title>
-    <style>
-        body { font-family: Arial; background: #1a1a2e; color: #fff; padding: 20px; text-align: center; }
-        h2 { color: #00d9ff; }
-        .upload-box { background: #16213e; padding: 30px; border-radius: 15px; margin: 20px auto; max-width: 400px; }
-        input[type="file"] { margin: 20px 0; }
-        button { background: #00d9ff; color: #000; border: none; padding: 15px 40px; font-size: 18px; border-radius: 10px; cursor: pointer; }
-        button:hover { background: #00b8d4; }
-        #progress { margin-top: 20px; }
-        .bar { background: #333; border-radius: 10px; height: 20px; overflow: hidden; }
-        .fill { background: #00d9ff; height: 100%; width: 0%; transition: width 0.3s; }
-    </style>
-</head>
-<body>
-    <h2>Simo 固件升级</h2>
-    <div class="upload-box">
-        <form method="POST" action="/update" enctype="multipart/form-data" id="uploadForm">
-            <input type="file" name="update" accept=".bin" required><br>
-            <button type="submit">开始升级</button>
-        </form>
-        <div id="progress" style="display:none;">
-            <p>升级中...</p>
-            <div class="bar"><div class="fill" id="fill"></div></div>
-        </div>
-    </div>
-    <script>
-        document.getElementById('uploadForm').onsubmit = function() {
-            document.getElementById('progress').style.display = 'block';
-            var fill = document.getElementById('fill');
-            var p = 0;
-            var timer = setInterval(function() { if(p < 90) { p += 10; fill.style.width = p + '%'; } }, 500);
-        };
-    </script>
-</body>
-</html>
-)rawliteral";
-    server.send(200, "text/html", otaPage);
+    sendPage(WEB_OTA);
 }
 
 // OTA升级处理
@@ -648,7 +547,7 @@ void handleUpdateUpload() {
         }
     } else if (upload.status == UPLOAD_FILE_END) {
         if (Update.end(true)) {
-            Serial.printf("[OTA] 升级完成: %u 字节\n", upload.totalSize);
+            Serial.printf("[OTA] 升级完成: %u 字节\n", (unsigned)upload.totalSize);
         } else {
             Update.printError(Serial);
         }
@@ -665,31 +564,29 @@ void handleVoice() {
         
         // 语音命令解析
         if (text.indexOf("前进") >= 0 || text.indexOf("往前") >= 0) {
-            currentMode = MODE_MANUAL;
-            sendToSTM32("F", 150, 1000);
+            postMode(MODE_MANUAL);
+            postMotion(CMD_FORWARD, 150, 1000);
             response = "好的，前进";
         } else if (text.indexOf("后退") >= 0 || text.indexOf("往后") >= 0) {
-            currentMode = MODE_MANUAL;
-            sendToSTM32("B", 150, 1000);
+            postMode(MODE_MANUAL);
+            postMotion(CMD_BACKWARD, 150, 1000);
             response = "好的，后退";
         } else if (text.indexOf("左转") >= 0 || text.indexOf("往左") >= 0) {
-            currentMode = MODE_MANUAL;
-            sendToSTM32("L", 150, 500);
+            postMode(MODE_MANUAL);
+            postMotion(CMD_LEFT, 150, 500);
             response = "好的，左转";
         } else if (text.indexOf("右转") >= 0 || text.indexOf("往右") >= 0) {
-            currentMode = MODE_MANUAL;
-            sendToSTM32("R", 150, 500);
+            postMode(MODE_MANUAL);
+            postMotion(CMD_RIGHT, 150, 500);
             response = "好的，右转";
         } else if (text.indexOf("停") >= 0 || text.indexOf("别动") >= 0) {
-            currentMode = MODE_IDLE;
-            sendToSTM32("S");
+            postMode(MODE_IDLE);
             response = "好的，停下";
         } else if (text.indexOf("巡逻") >= 0 || text.indexOf("巡逾") >= 0) {
-            currentMode = MODE_PATROL;
-            patrolState = 0;
+            postMode(MODE_PATROL);
             response = "好的，开始巡逻";
         } else if (text.indexOf("回家") >= 0 || text.indexOf("返航") >= 0) {
-            currentMode = MODE_RETURN;
+            postMode(MODE_RETURN);
             response = "好的，正在返航";
         } else {
             response = "不明白，可以说前进、后退、左转、右转、停、巡逻、返航";
@@ -703,29 +600,34 @@ void handleVoice() {
 void handleMode() {
     String mode = server.arg("m");
     String response = "OK";
+    RobotMode target = MODE_IDLE;
+    bool valid = true;
     
     if (mode == "idle" || mode == "0") {
-        currentMode = MODE_IDLE;
-        sendToSTM32("S");
+        target = MODE_IDLE;
         response = "已切换到空闲模式";
     } else if (mode == "manual" || mode == "1") {
-        currentMode = MODE_MANUAL;
+        target = MODE_MANUAL;
         response = "已切换到手动模式";
     } else if (mode == "patrol" || mode == "2") {
-        currentMode = MODE_PATROL;
-        patrolState = 0;
+        target = MODE_PATROL;
         response = "已切换到巡逻模式";
     } else if (mode == "follow" || mode == "3") {
-        currentMode = MODE_FOLLOW;
+        target = MODE_FOLLOW;
         response = "已切换到跟随模式";
     } else if (mode == "return" || mode == "4") {
-        currentMode = MODE_RETURN;
+        target = MODE_RETURN;
         response = "已切换到返航模式";
     } else {
+        valid = false;
         response = "无效模式，可选: idle/manual/patrol/follow/return";
     }
     
-    Serial.printf("[MODE] %s -> %d\n", mode.c_str(), currentMode);
+    if (valid && !postMode(target)) {
+        response = "ERR,busy";
+    }
+    
+    Serial.printf("[MODE] %s -> %d\n", mode.c_str(), valid ? target : -1);
     server.send(200, "text/plain; charset=utf-8", response);
 }
 
@@ -764,76 +666,9 @@ void clearWiFiCredentials() {
     Serial.println("[NVS] WiFi凭证已清除");
 }
 
-// WiFi配网页面
-const char* wifiSetupPage = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>Simo WiFi配置</title>
-    <style>
-        body { font-family: Arial; background: #1a1a2e; color: #fff; padding: 20px; }
-        h2 { color: #00d9ff; text-align: center; }
-        .box { background: #16213e; padding: 20px; border-radius: 15px; max-width: 350px; margin: 20px auto; }
-        label { display: block; margin: 15px 0 5px; }
-        input, select { width: 100%; padding: 12px; border: none; border-radius: 8px; font-size: 16px; }
-        button { width: 100%; background: #00d9ff; color: #000; border: none; padding: 15px; font-size: 18px; border-radius: 10px; cursor: pointer; margin-top: 20px; }
-        button:hover { background: #00b8d4; }
-        .scan { background: #4CAF50; margin-bottom: 10px; }
-        #networks { max-height: 200px; overflow-y: auto; }
-        .net { padding: 10px; margin: 5px 0; background: #0f3460; border-radius: 8px; cursor: pointer; }
-        .net:hover { background: #1a4a7a; }
-        .status { text-align: center; margin-top: 15px; color: #aaa; }
-    </style>
-</head>
-<body>
-    <h2>🤖 Simo WiFi配置</h2>
-    <div class="box">
-        <button class="scan" onclick="scan()">扫描WiFi网络</button>
-        <div id="networks"></div>
-        <label>WiFi名称 (SSID)</label>
-        <input type="text" id="ssid" required>
-        <label>WiFi密码</label>
-        <input type="password" id="password">
-        <button onclick="saveWifi()">保存并连接</button>
-        <p class="status" id="status"></p>
-    </div>
-    <script>
-        function scan() {
-            document.getElementById('status').innerText = '扫描中...';
-            fetch('/wifi/scan').then(r => r.json()).then(data => {
-                let html = '';
-                data.forEach(n => {
-                    html += '<div class="net" onclick="selectNet(\'' + n.ssid + '\')">' + n.ssid + ' (' + n.rssi + 'dBm)</div>';
-                });
-                document.getElementById('networks').innerHTML = html;
-                document.getElementById('status').innerText = '找到 ' + data.length + ' 个网络';
-            }).catch(e => {
-                document.getElementById('status').innerText = '扫描失败';
-            });
-        }
-        function selectNet(ssid) {
-            document.getElementById('ssid').value = ssid;
-        }
-        function saveWifi() {
-            const ssid = document.getElementById('ssid').value;
-            const pass = document.getElementById('password').value;
-            if (!ssid) { document.getElementById('status').innerText = '请输入WiFi名称'; return; }
-            document.getElementById('status').innerText = '正在连接...';
-            fetch('/wifi/save', { method: 'POST', body: new URLSearchParams({ssid: ssid, password: pass}) })
-                .then(r => r.text()).then(t => {
-                    document.getElementById('status').innerHTML = t;
-                });
-        }
-    </script>
-</body>
-</html>
-)rawliteral";
-
 // WiFi配置页面
 void handleWiFiSetup() {
-    server.send(200, "text/html", wifiSetupPage);
+    sendPage(WEB_WIFI);
 }
 
 // WiFi扫描
@@ -1087,14 +922,29 @@ void setup() {
     Serial.printf("  Flash: %dMB, PSRAM: %dMB\n", 
         ESP.getFlashChipSize() / 1024 / 1024,
         ESP.getPsramSize() / 1024 / 1024);
-    Serial.printf("  堆内存: %lu bytes\n", ESP.getFreeHeap());
+    Serial.printf("  堆内存: %lu bytes\n", (unsigned long)ESP.getFreeHeap());
     
     // LED
     pinMode(LED_PIN, OUTPUT);
     digitalWrite(LED_PIN, HIGH);  // 自检中：LED亮
     
     // STM32 串口
+    stm32Serial.setRxBufferSize(512);
+    stm32Serial.setTxBufferSize(256);  // 发送走缓冲，不等待 FIFO
     stm32Serial.begin(STM32_BAUD, SERIAL_8N1, STM32_RX, STM32_TX);
+    stm32Link.begin(stm32Serial);
+    if (deadReckoning.begin()) {
+        Serial.printf("  返航路点缓冲: %u 个\n", (unsigned)deadReckoning.crumbCapacity());
+    }
+    if (telemetryLog.begin()) {
+        Serial.printf("  遥测历史: %u 条（%u 分钟）\n", (unsigned)telemetryLog.capacity(),
+            (unsigned)(telemetryLog.capacity() * TLOG_PERIOD_MS / 60000));
+    }
+    stm32Link.onAck(onStm32Ack);
+    stm32Link.onSensor(onStm32Sensor);
+    stm32Link.onSensorData(onStm32SensorData);
+    stm32Link.onPong(onStm32Pong);
+    stm32Link.onUnsolicited(onStm32Unsolicited);
     Serial.printf("  STM32串口: TX=%d, RX=%d\n", STM32_TX, STM32_RX);
     
     // Phase 1: 网络连接
@@ -1138,26 +988,33 @@ void setup() {
     Serial.println("[Phase 2] 服务启动...");
     
     // Web 服务器路由
-    server.on("/", handleRoot);
-    server.on("/cmd", handleCmd);
-    server.on("/status", handleStatus);
-    server.on("/ping", handlePing);
-    server.on("/info", handleInfo);
-    server.on("/voice", handleVoice);
-    server.on("/mode", handleMode);
-    server.on("/ota", handleOTA);
-    server.on("/update", HTTP_POST, handleUpdate, handleUpdateUpload);
+    // 处理耗时计入 /metrics
+    server.on("/", metrics.timed("/", handleRoot));
+    server.on("/cmd", metrics.timed("/cmd", handleCmd));
+    server.on("/vel", metrics.timed("/vel", handleVelocity));
+    server.on("/status", metrics.timed("/status", handleStatus));
+    server.on("/telemetry", metrics.timed("/telemetry", handleTelemetry));
+    server.on("/metrics", handleMetrics);
+    server.on("/ping", metrics.timed("/ping", handlePing));
+    server.on("/info", metrics.timed("/info", handleInfo));
+    server.on("/voice", metrics.timed("/voice", handleVoice));
+    server.on("/mode", metrics.timed("/mode", handleMode));
+    server.on("/ota", metrics.timed("/ota", handleOTA));
+    server.on("/update", HTTP_POST, metrics.timed("/update", handleUpdate), handleUpdateUpload);
     
     // WiFi配置路由
-    server.on("/wifi", handleWiFiSetup);
-    server.on("/wifi/scan", handleWiFiScan);
-    server.on("/wifi/save", HTTP_POST, handleWiFiSave);
-    server.on("/wifi/clear", handleWiFiClear);
+    server.on("/wifi", metrics.timed("/wifi", handleWiFiSetup));
+    server.on("/wifi/scan", metrics.timed("/wifi/scan", handleWiFiScan));
+    server.on("/wifi/save", HTTP_POST, metrics.timed("/wifi/save", handleWiFiSave));
+    server.on("/wifi/clear", metrics.timed("/wifi/clear", handleWiFiClear));
     
     // OTA路由
-    server.on("/ota/status", handleOTAStatus);
-    server.on("/ota/check", handleOTACheck);
+    server.on("/ota/status", metrics.timed("/ota/status", handleOTAStatus));
+    server.on("/ota/check", metrics.timed("/ota/check", handleOTACheck));
     
+    // 页面缓存验证（sendPage）需要的请求头
+    const char* headerKeys[] = {"If-None-Match"};
+    server.collectHeaders(headerKeys, 1);
     server.begin();
     
     // 启动时向Node后端注册并检查OTA更新
@@ -1177,123 +1034,346 @@ void setup() {
     Serial.println("================================");
     
     digitalWrite(LED_PIN, LOW);  // 就绪：LED灭
+    
+    // Phase 4: 启动网络/控制任务
+    startTasks();
 }
 
-// 解析STM32传感器响应
-// 新格式: SENSOR,D<dist>,OL<l>OR<r>,TL<l>TR<r>
-void parseSensorResponse(String& resp) {
-    // 距离: D<value>
-    int dIdx = resp.indexOf('D');
-    if (dIdx >= 0) {
-        int comma = resp.indexOf(',', dIdx);
-        if (comma < 0) comma = resp.length();
-        lastDistance = resp.substring(dIdx + 1, comma).toInt();
+// 新的传感器数据（文本 SENSOR 行或二进制传感器帧）
+// 旧固件不带的字段：避障/循迹保持上一次的值，采样时间视为未知，距离视为可信
+void applySensor(const SensorSnapshot& s) {
+    lastDistance = s.distance;
+    lastDistanceValid = s.distanceValid;
+    if (s.fields & SENSOR_HAS_OBS) {
+        leftIR = s.leftIR;
+        rightIR = s.rightIR;
+    }
+    if (s.fields & SENSOR_HAS_TRACK) {
+        leftTrack = s.leftTrack;
+        rightTrack = s.rightTrack;
+    }
+    lastSensorStamp = s.sampleMs;
+    lastSensorUpdate = millis();
+    sensorSamples++;
+}
+
+// ============ STM32 链路回调 ============
+void onStm32Ack(const char* cmd, const char* line, size_t len, uint32_t rttMs) {
+    telemetryLog.noteAck(rttMs, line == nullptr);
+    if (line) {
+        metrics.stm32Rtt(cmd, rttMs);
+    } else {
+        metrics.stm32Timeout(cmd);
+    }
+    if (line) {
+        Serial.printf("[<-STM32] %s (%lums)\n", line, (unsigned long)rttMs);
+    } else {
+        Serial.printf("[STM32] 命令 %s 应答超时\n", cmd);
     }
     
-    // 红外避障: OL<0/1>OR<0/1>
-    int olIdx = resp.indexOf("OL");
-    if (olIdx >= 0 && olIdx + 2 < resp.length()) {
-        leftIR = resp.charAt(olIdx + 2) == '1';
+    if (line && strcmp(cmd, "STREAM") == 0 && strncmp(line, "ERR", 3) == 0) {
+        streamUnsupported = true;
+        Serial.println("[STM32] 固件不支持传感器流，改为轮询");
+    }
+}
+
+// 直接解析行缓冲区（sensor_parse.h），格式错误的行丢弃，不计入样本
+void onStm32Sensor(const char* line, size_t len) {
+    SensorSnapshot s;
+    if (!parseSensorLine(line, len, &s)) {
+        sensorRejects++;
+        Serial.printf("[STM32] 传感器数据格式错误: %s\n", line);
+        return;
     }
-    int orIdx = resp.indexOf("OR");
-    if (orIdx >= 0 && orIdx + 2 < resp.length()) {
-        rightIR = resp.charAt(orIdx + 2) == '1';
+    applySensor(s);
+}
+
+// 二进制协议的传感器帧（应答 SENSOR_REQ 或传感器流）
+void onStm32SensorData(uint16_t distance, uint8_t flags, uint32_t stampMs) {
+    SensorSnapshot s = {};
+    s.distance = distance;
+    s.distanceValid = !(flags & SENSOR_FLAG_DIST_BAD);
+    s.leftIR = flags & SENSOR_FLAG_OBS_L;
+    s.rightIR = flags & SENSOR_FLAG_OBS_R;
+    s.leftTrack = flags & SENSOR_FLAG_TRK_L;
+    s.rightTrack = flags & SENSOR_FLAG_TRK_R;
+    s.sampleMs = stampMs;
+    s.fields = SENSOR_HAS_DIST | SENSOR_HAS_OBS | SENSOR_HAS_TRACK | SENSOR_HAS_VALID |
+               (stampMs ? SENSOR_HAS_STAMP : 0);
+    applySensor(s);
+}
+
+void onStm32Pong(bool ok, uint32_t rttMs) {
+    metrics.pong(ok, rttMs);
+    if (ok && !stm32Connected) {
+        Serial.println("[STM32] 连接正常");
     }
+    stm32Connected = ok;
     
-    // 红外循迹: TL<0/1>TR<0/1>
-    int tlIdx = resp.indexOf("TL");
-    if (tlIdx >= 0 && tlIdx + 2 < resp.length()) {
-        leftTrack = resp.charAt(tlIdx + 2) == '1';
+#if STM32_BINARY_PROTOCOL
+    if (ok) {
+        stm32Link.requestBinary();
     }
-    int trIdx = resp.indexOf("TR");
-    if (trIdx >= 0 && trIdx + 2 < resp.length()) {
-        rightTrack = resp.charAt(trIdx + 2) == '1';
+#endif
+}
+
+void onStm32Unsolicited(const char* line, size_t len) {
+    Serial.printf("[<-STM32] %s\n", line);
+}
+
+// ============ 任务间消息 ============
+// 以下两个函数只在网络任务（HTTP 处理函数）中调用
+bool postMotion(Stm32Cmd cmd, int speed, int duration) {
+    ControlMsg msg = {};
+    msg.type = ControlMsg::MOTION;
+    msg.cmd = cmd;
+    msg.speed = speed;
+    msg.duration = stm32cmd::clampU16(duration);
+    return netToControl.push(msg);
+}
+
+// text 由调用者校验过（stm32TextCmdValid）；放不进 ControlMsg::text 的返回 false，不截断
+bool postText(const char* text) {
+    ControlMsg msg = {};
+    size_t n = strlen(text);
+    if (n >= sizeof(msg.text)) return false;
+    msg.type = ControlMsg::TEXT;
+    memcpy(msg.text, text, n + 1);
+    return netToControl.push(msg);
+}
+
+bool postVelocity(int8_t left, int8_t right) {
+    ControlMsg msg = {};
+    msg.type = ControlMsg::VELOCITY;
+    msg.left = left;
+    msg.right = right;
+    return netToControl.push(msg);
+}
+
+bool postMode(RobotMode mode) {
+    ControlMsg msg = {};
+    msg.type = ControlMsg::MODE;
+    msg.mode = mode;
+    return netToControl.push(msg);
+}
+
+// 模式切换（控制任务中执行）
+void applyMode(RobotMode mode) {
+    currentMode = mode;
+    deadReckoning.setRecording(mode != MODE_RETURN);
+    if (mode == MODE_IDLE) {
+        sendToSTM32(CMD_STOP);
+    } else if (mode == MODE_PATROL) {
+        avoidance.reset();
+        patrolSeenSamples = sensorSamples;
+    } else if (mode == MODE_RETURN) {
+        returnNextAt = 0;
+        returnBlocked = false;
+        Serial.printf("[RETURN] 开始返航，%u 个路点\n", (unsigned)deadReckoning.crumbCount());
     }
+}
+
+// 摇杆接管：自主模式下收到速度设定值先切到手动，避免巡逻/返航的命令和摇杆互相覆盖
+void sendVelocity(const ControlMsg& msg) {
+    if (currentMode != MODE_MANUAL) applyMode(MODE_MANUAL);
+    sendToSTM32(CMD_VELOCITY, msg.left, msg.right);
+}
+
+// 连续的速度设定值只发最新一条（网页发得比控制周期快时不在串口上排队），
+// 与其他消息之间保持原有顺序
+void drainControlQueue(ControlQueue& queue) {
+    ControlMsg msg;
+    ControlMsg velocity;
+    bool velocityPending = false;
     
-    // 兼容旧格式: SENSOR,D123,L0R1
-    if (olIdx < 0) {
-        int lIdx = resp.indexOf('L');
-        if (lIdx >= 0 && lIdx + 1 < resp.length() && resp.charAt(lIdx + 1) != 'O') {
-            leftIR = resp.charAt(lIdx + 1) == '1';
+    while (queue.pop(msg)) {
+        if (msg.type == ControlMsg::VELOCITY) {
+            velocity = msg;
+            velocityPending = true;
+            continue;
         }
-        int rIdx = resp.indexOf('R');
-        if (rIdx >= 0 && rIdx + 1 < resp.length() && resp.charAt(rIdx + 1) != 'O') {
-            rightIR = resp.charAt(rIdx + 1) == '1';
+        if (velocityPending) {
+            sendVelocity(velocity);
+            velocityPending = false;
+        }
+        if (msg.type == ControlMsg::MODE) {
+            applyMode(msg.mode);
+        } else if (msg.type == ControlMsg::TEXT) {
+            sendTextToSTM32(msg.text);
+        } else {
+            sendToSTM32(msg.cmd, msg.speed, msg.duration);
         }
     }
+    if (velocityPending) sendVelocity(velocity);
 }
 
-// ============ 主循环 ============
-void loop() {
-    server.handleClient();
+void publishControlStatus() {
+    ControlStatus st;
+    st.sensor.distance = lastDistance;
+    st.sensor.distanceValid = lastDistanceValid;
+    st.sensor.leftIR = leftIR;
+    st.sensor.rightIR = rightIR;
+    st.sensor.leftTrack = leftTrack;
+    st.sensor.rightTrack = rightTrack;
+    st.sensor.updatedAt = lastSensorUpdate;
+    st.sensor.sampleMs = lastSensorStamp;
+    st.stm32Connected = stm32Connected;
+    st.mode = currentMode;
+    strncpy(st.lastAck, stm32Link.lastAck(), sizeof(st.lastAck) - 1);
+    st.lastAck[sizeof(st.lastAck) - 1] = '\0';
+    st.ackRtt = stm32Link.lastAckRtt();
+    st.ackTimeouts = stm32Link.ackTimeouts();
+    st.frameErrors = stm32Link.frameErrors();
+    st.sensorRejects = sensorRejects;
+    st.tick = lastTickStats;
+    st.pose = deadReckoning.pose();
+    st.crumbs = deadReckoning.crumbCount();
+    controlStatus.write(st);
+}
+
+// ============ 控制任务（core 1） ============
+// esp_timer 回调只负责唤醒控制任务
+void onControlTimer(void* arg) {
+    xTaskNotifyGive(controlTaskHandle);
+}
+
+// 一个控制周期：收发 STM32、定时查询、自主导航、发布快照
+void controlTick() {
+    drainControlQueue(netToControl);
+    drainControlQueue(wsToControl);
     
-    // LED 心跳（连接STM32时快闪，否则慢闪）
-    static unsigned long lastBlink = 0;
-    int blinkInterval = stm32Connected ? 500 : 2000;
-    if (millis() - lastBlink >= blinkInterval) {
-        lastBlink = millis();
-        digitalWrite(LED_PIN, !digitalRead(LED_PIN));
-    }
+    // 收取 STM32 数据并分发（应答/传感器/心跳/主动上报）
+    stm32Link.poll();
     
-    // 定期PING STM32检查连接状态
+    // 定期PING STM32检查连接状态（结果在 onStm32Pong 中处理）
     if (millis() - lastStm32Ping >= 5000) {
         lastStm32Ping = millis();
-        stm32Serial.print("PING\n");
-        
-        unsigned long start = millis();
-        while (!stm32Serial.available() && millis() - start < 200) {
-            delay(10);
-        }
-        
-        if (stm32Serial.available()) {
-            String resp = stm32Serial.readStringUntil('\n');
-            stm32Connected = (resp.indexOf("PONG") >= 0);
-            if (stm32Connected) {
-                Serial.println("[STM32] 连接正常");
-            }
-        } else {
-            stm32Connected = false;
-        }
+        stm32Link.ping();
     }
     
-    // 定期读取传感器数据
-    if (stm32Connected && millis() - lastSensorRead >= 1000) {
+    // 传感器数据（结果在 onStm32Sensor / onStm32SensorData 中处理）
+    // 优先让 STM32 按固定频率主动上报；流中断（STM32 复位等）时重新开启，
+    // 期间以及固件不支持时每秒轮询一次
+    bool streaming = STM32_STREAM_HZ > 0 && !streamUnsupported;
+    bool sensorFresh = millis() - lastSensorUpdate < SENSOR_STALE_MS;
+    if (stm32Connected && streaming && !sensorFresh && millis() - lastStreamRequest >= 1000) {
+        lastStreamRequest = millis();
+        sendToSTM32(CMD_STREAM, 0, STM32_STREAM_HZ);
+    }
+    unsigned long pollMs = currentMode == MODE_PATROL ? PATROL_POLL_MS : 1000;
+    if (stm32Connected && !(streaming && sensorFresh) && millis() - lastSensorRead >= pollMs) {
         lastSensorRead = millis();
-        stm32Serial.print("SENSOR\n");
+        sendToSTM32(CMD_SENSOR);
+    }
+    
+    // 位姿估计推进到当前时刻（命令在 sendToSTM32 中记录）
+    deadReckoning.update(millis());
+    
+    // 自主导航逻辑
+    runAutonomousLogic();
+    
+    uint8_t flags = (leftIR ? TLOG_OBS_L : 0) | (rightIR ? TLOG_OBS_R : 0) |
+                    (leftTrack ? TLOG_TRK_L : 0) | (rightTrack ? TLOG_TRK_R : 0) |
+                    (lastDistanceValid ? 0 : TLOG_DIST_BAD) |
+                    (millis() - lastSensorUpdate >= SENSOR_STALE_MS ? TLOG_SENSOR_STALE : 0) |
+                    (stm32Connected ? 0 : TLOG_STM32_DOWN);
+    telemetryLog.sample(millis(), lastDistance, flags, currentMode);
+    
+    publishControlStatus();
+}
+
+void controlTask(void* arg) {
+    int64_t lastWake = esp_timer_get_time();
+    int64_t windowStart = lastWake;
+    uint64_t jitterSum = 0;
+    TickStats win = {};
+    
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        
+        // 抖动：实际唤醒间隔与设定周期之差
+        int64_t wake = esp_timer_get_time();
+        int32_t late = (int32_t)(wake - lastWake - CONTROL_PERIOD_US);
+        metrics.controlPeriod((uint32_t)(wake - lastWake));
+        lastWake = wake;
+        uint32_t absLate = late < 0 ? -late : late;
+        jitterSum += absLate;
+        if (absLate > (uint32_t)abs(win.maxLateUs)) win.maxLateUs = late;
         
-        unsigned long start = millis();
-        while (!stm32Serial.available() && millis() - start < 100) {
-            delay(10);
+        controlTick();
+        
+        uint32_t work = (uint32_t)(esp_timer_get_time() - wake);
+        if (work > win.maxWorkUs) win.maxWorkUs = work;
+        if (work > CONTROL_PERIOD_US) {
+            win.overruns++;
+            metrics.controlOverrun();
         }
+        win.ticks++;
         
-        if (stm32Serial.available()) {
-            String resp = stm32Serial.readStringUntil('\n');
-            parseSensorResponse(resp);
+        if (wake - windowStart >= (int64_t)TICK_STATS_WINDOW_MS * 1000) {
+            win.avgJitterUs = (uint32_t)(jitterSum / win.ticks);
+            lastTickStats = win;
+            win = {};
+            jitterSum = 0;
+            windowStart = wake;
         }
     }
+}
+
+// ============ 网络任务（core 0） ============
+void netTask(void* arg) {
+    static unsigned long lastBlink = 0;
+    static unsigned long lastRegister = 0;
+    
+    telemetryWsBegin();
     
-    // 读取 STM32 主动发送的数据
-    while (stm32Serial.available()) {
-        String line = stm32Serial.readStringUntil('\n');
-        Serial.printf("[<-STM32] %s\n", line.c_str());
+    while (true) {
+        server.handleClient();
+        telemetryWsLoop();
+        
+        // LED 心跳（连接STM32时快闪，否则慢闪）
+        bool connected = controlStatus.read().stm32Connected;
+        unsigned long blinkInterval = connected ? 500 : 2000;
+        if (millis() - lastBlink >= blinkInterval) {
+            lastBlink = millis();
+            digitalWrite(LED_PIN, !digitalRead(LED_PIN));
+        }
         
-        // 解析响应
-        if (line.startsWith("SENSOR")) {
-            parseSensorResponse(line);
-        } else if (line.indexOf("PONG") >= 0) {
-            stm32Connected = true;
+        // 定期向Node后端注册心跳（每60秒）
+        if (staConnected && millis() - lastRegister >= 60000) {
+            lastRegister = millis();
+            registerToBackend();
         }
+        
+        vTaskDelay(1);
     }
+}
+
+void startTasks() {
+    xTaskCreatePinnedToCore(controlTask, "control", CONTROL_TASK_STACK, nullptr,
+                            CONTROL_TASK_PRIORITY, &controlTaskHandle, CONTROL_TASK_CORE);
+    xTaskCreatePinnedToCore(netTask, "net", NET_TASK_STACK, nullptr,
+                            NET_TASK_PRIORITY, nullptr, NET_TASK_CORE);
     
-    // 定期向Node后端注册心跳（每60秒）
-    static unsigned long lastRegister = 0;
-    if (staConnected && millis() - lastRegister >= 60000) {
-        lastRegister = millis();
-        registerToBackend();
-    }
+    const esp_timer_create_args_t timerArgs = {
+        .callback = onControlTimer,
+        .arg = nullptr,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "control_tick",
+        .skip_unhandled_events = true,
+    };
+    esp_timer_handle_t timer;
+    esp_timer_create(&timerArgs, &timer);
+    esp_timer_start_periodic(timer, CONTROL_PERIOD_US);
     
-    // 自主导航逻辑
-    runAutonomousLogic();
+    Serial.printf("[TASK] 网络任务@core%d, 控制任务@core%d (%dus)\n",
+                  NET_TASK_CORE, CONTROL_TASK_CORE, CONTROL_PERIOD_US);
+}
+
+// ============ 主循环 ============
+// 工作都在 netTask/controlTask 中完成，Arduino loop 任务不再需要
+void loop() {
+    vTaskDelete(NULL);
 }
 
 // ============ 自主导航逻辑 ============
@@ -1304,32 +1384,7 @@ void runAutonomousLogic() {
     
     switch (currentMode) {
         case MODE_PATROL:
-            // 简单巡逻逻辑：前进→检测障碍→转向→继续
-            if (now - lastPatrolAction >= 500) {
-                lastPatrolAction = now;
-                
-                // 障碍物检测（距离<30cm）
-                if (lastDistance > 0 && lastDistance < 30) {
-                    // 有障碍，停止并转向
-                    sendToSTM32("S");
-                    delay(100);
-                    
-                    // 随机左转或右转
-                    if (random(2) == 0) {
-                        sendToSTM32("L", 120, 300);
-                    } else {
-                        sendToSTM32("R", 120, 300);
-                    }
-                    patrolState = 1;  // 转向中
-                    Serial.printf("[PATROL] 障碍物! D=%dcm, 转向\n", lastDistance);
-                } else if (patrolState == 1) {
-                    // 转向完成，继续前进
-                    patrolState = 0;
-                } else {
-                    // 无障碍，前进
-                    sendToSTM32("F", 100, 600);
-                }
-            }
+            runPatrol(now);
             break;
             
         case MODE_FOLLOW:
@@ -1338,11 +1393,117 @@ void runAutonomousLogic() {
             break;
             
         case MODE_RETURN:
-            // 返航模式：返回起始点（需要定位模块）
-            // TODO: 待定位模块实现
+            // 返航模式：沿航位推算记录的路点倒序返回起始点
+            runReturnHome(now);
             break;
             
         default:
             break;
     }
 }
+
+// ============ 巡逻避障 ============
+// 每个新传感器样本立即决策（流 20Hz 时反应时间约 50ms），没有新样本时只检查数据是否中断
+void runPatrol(unsigned long now) {
+    AvoidAction act;
+    
+    if (sensorSamples != patrolSeenSamples) {
+        patrolSeenSamples = sensorSamples;
+        AvoidSample sample = {
+            lastDistance,                   // 0.1cm 即 mm
+            lastDistanceValid,
+            leftIR == IR_OBS_ACTIVE,
+            rightIR == IR_OBS_ACTIVE,
+            lastSensorUpdate
+        };
+        act = avoidance.onSample(sample);
+    } else {
+        act = avoidance.onTick(now, lastSensorUpdate);
+    }
+    
+    switch (act.type) {
+        case AvoidAction::FORWARD:
+            sendToSTM32(CMD_FORWARD, act.pwm, act.ms);
+            break;
+        case AvoidAction::TURN_LEFT:
+        case AvoidAction::TURN_RIGHT: {
+            bool left = act.type == AvoidAction::TURN_LEFT;
+            sendToSTM32(left ? CMD_LEFT : CMD_RIGHT, act.pwm, act.ms);
+            Serial.printf("[PATROL] 障碍物 D=%dmm IR=%d%d, %s转\n",
+                          lastDistance, leftIR, rightIR, left ? "左" : "右");
+            break;
+        }
+        case AvoidAction::BACK:
+            sendToSTM32(CMD_BACKWARD, act.pwm, act.ms);
+            Serial.printf("[PATROL] 距离过近 D=%dmm, 后退\n", lastDistance);
+            break;
+        case AvoidAction::STOP:
+            sendToSTM32(CMD_STOP);
+            Serial.println("[PATROL] 传感器数据中断，停车等待");
+            break;
+        default:
+            break;
+    }
+}
+
+// ============ 返航 ============
+// 每个控制周期调用一次，一次最多发一条命令：
+// 先原地转向下一个路点，对准后前进（每条不超过 RETURN_MAX_MOVE_MS，之后重新对准），
+// 到达后取下一个路点；路点用完后回到原点，停车并切回空闲
+void runReturnHome(unsigned long now) {
+    // 上一条命令还在执行（或刚结束、斜坡未停稳）
+    if (deadReckoning.moving() || (long)(now - returnNextAt) < 0) return;
+    
+    // 前方障碍：停车等待，障碍消失后继续
+    if (lastDistanceValid && lastDistance > 0 && lastDistance < RETURN_OBSTACLE_MM) {
+        if (!returnBlocked) {
+            returnBlocked = true;
+            sendToSTM32(CMD_STOP);
+            Serial.printf("[RETURN] 前方障碍 D=%dmm，等待\n", lastDistance);
+        }
+        return;
+    }
+    returnBlocked = false;
+    
+    const Pose& pose = deadReckoning.pose();
+    Breadcrumb crumb;
+    float tx = 0, ty = 0, dist = 0;
+    bool haveCrumb = false;
+    
+    while (deadReckoning.peekCrumb(&crumb)) {
+        tx = crumb.x * 10.0f;
+        ty = crumb.y * 10.0f;
+        dist = hypotf(tx - pose.x, ty - pose.y);
+        if (dist >= RETURN_ARRIVE_MM) {
+            haveCrumb = true;
+            break;
+        }
+        deadReckoning.popCrumb();
+    }
+    if (!haveCrumb) {
+        tx = ty = 0;
+        dist = hypotf(pose.x, pose.y);
+        if (dist < RETURN_ARRIVE_MM) {
+            Serial.printf("[RETURN] 已返回起点 (%.0f, %.0f)mm\n", pose.x, pose.y);
+            deadReckoning.clearCrumbs();
+            applyMode(MODE_IDLE);
+            return;
+        }
+    }
+    
+    float err = atan2f(ty - pose.y, tx - pose.x) - pose.heading;
+    while (err > PI) err -= 2 * PI;
+    while (err <= -PI) err += 2 * PI;
+    
+    int ms;
+    if (fabsf(err) > radians(RETURN_HEADING_TOL)) {
+        bool left = err > 0;
+        ms = (int)(degrees(fabsf(err)) * 1000 / (left ? DR_TURN_L_DEG_S : DR_TURN_R_DEG_S));
+        sendToSTM32(left ? CMD_LEFT : CMD_RIGHT, DR_DEFAULT_PWM, ms);
+    } else {
+        ms = (int)(dist * 1000 / DR_SPEED_F_MM_S);
+        if (ms > RETURN_MAX_MOVE_MS) ms = RETURN_MAX_MOVE_MS;
+        sendToSTM32(CMD_FORWARD, DR_DEFAULT_PWM, ms);
+    }
+    returnNextAt = now + ms + RETURN_SETTLE_MS;
+}
@@ -0,0 +1,149 @@
+/**
+ * 运行指标实现，见 metrics.h
+ */
+
+#include "metrics.h"
+#include <stdarg.h>
+
+Metrics metrics;
+
+// 导出的直方图边界（us），即 le="0.0005" ... le="2.5"
+static const uint32_t kLeUs[] = {500, 1000, 2500, 5000, 10000, 25000, 50000,
+                                 100000, 250000, 500000, 1000000, 2500000};
+
+static const char* const kCmdNames[METRICS_CMD_COUNT] = {
+    "motion", "stop", "seq", "sensor", "ping", "config"
+};
+
+// ============ 直方图 ============
+size_t LatencyHistogram::bucketOf(uint32_t us) {
+    if (us < 8) return us;
+    uint32_t e = 31 - __builtin_clz(us);
+    size_t b = 8 + (e - 3) * 4 + ((us >> (e - 2)) & 3);
+    return b < METRICS_HIST_BUCKETS ? b : METRICS_HIST_BUCKETS - 1;
+}
+
+uint32_t LatencyHistogram::bucketLower(size_t bucket) {
+    if (bucket < 8) return bucket;
+    uint32_t e = 3 + (bucket - 8) / 4;
+    uint32_t sub = (bucket - 8) % 4;
+    return (4 + sub) << (e - 2);
+}
+
+void LatencyHistogram::record(uint32_t us) {
+    buckets_[bucketOf(us)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(us, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::countBelow(uint32_t us) const {
+    uint64_t n = 0;
+    for (size_t b = 0; b < METRICS_HIST_BUCKETS && bucketLower(b) <= us; b++) {
+        n += buckets_[b].load(std::memory_order_relaxed);
+    }
+    return n;
+}
+
+// ============ 导出 ============
+void MetricsSink::printf(const char* fmt, ...) {
+    char buf[160];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (n > 0) write(buf, n < (int)sizeof(buf) ? n : sizeof(buf) - 1);
+}
+
+// labels 形如 cmd="motion"，不带大括号
+static void renderHistogram(MetricsSink& out, const char* name, const char* labels,
+                            const LatencyHistogram& h) {
+    const char* sep = labels[0] ? "," : "";
+    for (uint32_t le : kLeUs) {
+        out.printf("%s_bucket{%s%sle=\"%g\"} %llu\n", name, labels, sep, le / 1e6,
+                   (unsigned long long)h.countBelow(le));
+    }
+    out.printf("%s_bucket{%s%sle=\"+Inf\"} %llu\n", name, labels, sep,
+               (unsigned long long)h.count());
+    out.printf("%s_sum{%s} %.6f\n", name, labels, h.sumUs() / 1e6);
+    out.printf("%s_count{%s} %llu\n", name, labels, (unsigned long long)h.count());
+}
+
+void Metrics::render(MetricsSink& out) const {
+    char labels[48];
+
+    out.printf("# HELP simo_stm32_rtt_seconds STM32 command round-trip time (ms resolution)\n");
+    out.printf("# TYPE simo_stm32_rtt_seconds histogram\n");
+    for (int c = 0; c < METRICS_CMD_COUNT; c++) {
+        snprintf(labels, sizeof(labels), "cmd=\"%s\"", kCmdNames[c]);
+        renderHistogram(out, "simo_stm32_rtt_seconds", labels, rtt_[c]);
+    }
+
+    out.printf("# HELP simo_stm32_ack_timeouts_total STM32 commands without OK/ERR within the ack timeout\n");
+    out.printf("# TYPE simo_stm32_ack_timeouts_total counter\n");
+    for (int c = 0; c < METRICS_CMD_COUNT; c++) {
+        if (c == METRICS_CMD_PING) continue;
+        out.printf("simo_stm32_ack_timeouts_total{cmd=\"%s\"} %lu\n", kCmdNames[c],
+                   (unsigned long)timeouts_[c].load(std::memory_order_relaxed));
+    }
+
+    out.printf("# HELP simo_stm32_pong_failures_total Heartbeats without PONG\n");
+    out.printf("# TYPE simo_stm32_pong_failures_total counter\n");
+    out.printf("simo_stm32_pong_failures_total %lu\n",
+               (unsigned long)pongFailures_.load(std::memory_order_relaxed));
+
+    out.printf("# HELP simo_http_request_duration_seconds HTTP handler time per route\n");
+    out.printf("# TYPE simo_http_request_duration_seconds histogram\n");
+    for (size_t r = 0; r <= METRICS_MAX_ROUTES; r++) {
+        if (r < METRICS_MAX_ROUTES ? r >= routeCount_ : http_[r].count() == 0) continue;
+        snprintf(labels, sizeof(labels), "route=\"%s\"", r < METRICS_MAX_ROUTES ? routes_[r] : "other");
+        renderHistogram(out, "simo_http_request_duration_seconds", labels, http_[r]);
+    }
+
+    out.printf("# HELP simo_control_period_seconds Actual control task wake-up period\n");
+    out.printf("# TYPE simo_control_period_seconds histogram\n");
+    renderHistogram(out, "simo_control_period_seconds", "", controlPeriod_);
+
+    out.printf("# HELP simo_control_overruns_total Control ticks that took longer than the period\n");
+    out.printf("# TYPE simo_control_overruns_total counter\n");
+    out.printf("simo_control_overruns_total %lu\n",
+               (unsigned long)overruns_.load(std::memory_order_relaxed));
+}
+
+// ============ 记录 ============
+MetricsCmd Metrics::classify(const char* cmd) {
+    if (strcmp(cmd, "S") == 0 || strcmp(cmd, "SA") == 0) return METRICS_CMD_STOP;
+    if (cmd[0] && !cmd[1] && strchr("FBLRV", cmd[0])) return METRICS_CMD_MOTION;
+    if (strcmp(cmd, "SEQ") == 0) return METRICS_CMD_SEQ;
+    if (strcmp(cmd, "SENSOR") == 0) return METRICS_CMD_SENSOR;
+    if (strcmp(cmd, "PING") == 0) return METRICS_CMD_PING;
+    return METRICS_CMD_CONFIG;
+}
+
+void Metrics::stm32Rtt(const char* cmd, uint32_t rttMs) {
+    rtt_[classify(cmd)].record(rttMs * 1000);
+}
+
+void Metrics::stm32Timeout(const char* cmd) {
+    timeouts_[classify(cmd)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void Metrics::pong(bool ok, uint32_t rttMs) {
+    if (ok) {
+        rtt_[METRICS_CMD_PING].record(rttMs * 1000);
+    } else {
+        pongFailures_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+std::function<void(void)> Metrics::timed(const char* route, std::function<void(void)> handler) {
+    LatencyHistogram* h = &http_[METRICS_MAX_ROUTES];
+    if (routeCount_ < METRICS_MAX_ROUTES) {
+        routes_[routeCount_] = route;
+        h = &http_[routeCount_++];
+    }
+    return [h, handler]() {
+        uint32_t start = micros();
+        handler();
+        h->record(micros() - start);
+    };
+}
@@ -0,0 +1,90 @@
+/**
+ * STM32 传感器行解析，见 sensor_parse.h
+ */
+
+#include "sensor_parse.h"
+
+// 十进制整数 [p, end)，不大于 max
+static bool parseUint(const char* p, const char* end, uint32_t max, uint32_t* out) {
+    uint64_t v = 0;
+    if (p == end) return false;
+    for (; p < end; p++) {
+        if (*p < '0' || *p > '9') return false;
+        v = v * 10 + (*p - '0');
+        if (v > max) return false;
+    }
+    *out = (uint32_t)v;
+    return true;
+}
+
+static bool parseLevel(char c, bool* out) {
+    if (c != '0' && c != '1') return false;
+    *out = c == '1';
+    return true;
+}
+
+// "<a><l><b><r>" 形式的一对电平（OL1OR0 / TL1TR0 / L1R0）
+static bool parsePair(const char* p, const char* end, const char* left, const char* right,
+                      bool* l, bool* r) {
+    size_t nl = strlen(left), nr = strlen(right);
+    if ((size_t)(end - p) != nl + nr + 2) return false;
+    return memcmp(p, left, nl) == 0 && parseLevel(p[nl], l) &&
+           memcmp(p + nl + 1, right, nr) == 0 && parseLevel(p[nl + nr + 1], r);
+}
+
+bool parseSensorLine(const char* line, size_t len, SensorSnapshot* out) {
+    const char* end = line + len;
+    const char* p;
+    SensorSnapshot s = {};
+    uint32_t v;
+
+    if (len < 6 || memcmp(line, "SENSOR", 6) != 0) return false;
+    p = line + 6;
+    s.distanceValid = true;
+
+    while (p < end) {
+        if (*p++ != ',') return false;
+        const char* f = p;
+        while (p < end && *p != ',') p++;
+        if (f == p) return false;
+
+        switch (*f) {
+            case 'D': {
+                bool neg = p - f > 1 && f[1] == '-';
+                if (!parseUint(f + 1 + neg, p, 65535, &v)) return false;
+                s.distance = neg ? -(int)v : (int)v;
+                s.fields |= SENSOR_HAS_DIST;
+                break;
+            }
+            case 'O':
+                if (!parsePair(f, p, "OL", "OR", &s.leftIR, &s.rightIR)) return false;
+                s.fields |= SENSOR_HAS_OBS;
+                break;
+            case 'L':
+                if (!parsePair(f, p, "L", "R", &s.leftIR, &s.rightIR)) return false;
+                s.fields |= SENSOR_HAS_OBS;
+                break;
+            case 'T':
+                if (p - f > 1 && f[1] == 'L') {
+                    if (!parsePair(f, p, "TL", "TR", &s.leftTrack, &s.rightTrack)) return false;
+                    s.fields |= SENSOR_HAS_TRACK;
+                } else {
+                    if (!parseUint(f + 1, p, 0xFFFFFFFFu, &v)) return false;
+                    s.sampleMs = v;
+                    s.fields |= SENSOR_HAS_STAMP;
+                }
+                break;
+            case 'V':
+                if (p - f != 2 || !parseLevel(f[1], &s.distanceValid)) return false;
+                s.fields |= SENSOR_HAS_VALID;
+                break;
+            default:
+                if (*f < 'A' || *f > 'Z') return false;
+                break;
+        }
+    }
+
+    if (!(s.fields & SENSOR_HAS_DIST)) return false;
+    *out = s;
+    return true;
+}
@@ -0,0 +1,92 @@
+/**
+ * 二进制帧编解码，见 stm32_frame.h
+ */
+
+#include <string.h>
+#include "stm32_frame.h"
+
+uint16_t crc16Ccitt(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    while (len--) {
+        crc ^= (uint16_t)(*data++) << 8;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+size_t cobsEncode(const uint8_t* in, size_t len, uint8_t* out) {
+    size_t codeIdx = 0;
+    size_t o = 1;
+    uint8_t code = 1;
+
+    for (size_t i = 0; i < len; i++) {
+        if (in[i] == 0) {
+            out[codeIdx] = code;
+            codeIdx = o++;
+            code = 1;
+        } else {
+            out[o++] = in[i];
+            if (++code == 0xFF) {
+                out[codeIdx] = code;
+                codeIdx = o++;
+                code = 1;
+            }
+        }
+    }
+    out[codeIdx] = code;
+    return o;
+}
+
+size_t cobsDecode(const uint8_t* in, size_t len, uint8_t* out, size_t outSize) {
+    size_t i = 0;
+    size_t o = 0;
+
+    while (i < len) {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > len) return 0;
+
+        for (uint8_t k = 1; k < code; k++) {
+            if (o >= outSize) return 0;
+            out[o++] = in[i++];
+        }
+        // 0xFF 块后面不补 0；最后一块后面也不补
+        if (code != 0xFF && i < len) {
+            if (o >= outSize) return 0;
+            out[o++] = 0;
+        }
+    }
+    return o;
+}
+
+size_t frameEncode(uint8_t type, uint8_t seq, const uint8_t* payload, size_t len, uint8_t* out) {
+    if (len > FRAME_MAX_PAYLOAD) return 0;
+
+    uint8_t raw[FRAME_MAX_RAW];
+    raw[0] = type;
+    raw[1] = seq;
+    if (len) memcpy(raw + 2, payload, len);
+    uint16_t crc = crc16Ccitt(raw, len + 2);
+    raw[len + 2] = crc & 0xFF;
+    raw[len + 3] = crc >> 8;
+
+    size_t n = cobsEncode(raw, len + 4, out);
+    out[n++] = 0x00;
+    return n;
+}
+
+bool frameDecode(const uint8_t* in, size_t len, Stm32Frame* frame) {
+    uint8_t raw[FRAME_MAX_RAW];
+    size_t n = cobsDecode(in, len, raw, sizeof(raw));
+    if (n < 4) return false;
+
+    uint16_t crc = raw[n - 2] | (raw[n - 1] << 8);
+    if (crc16Ccitt(raw, n - 2) != crc) return false;
+
+    frame->type = raw[0];
+    frame->seq = raw[1];
+    frame->len = n - 4;
+    memcpy(frame->payload, raw + 2, frame->len);
+    return true;
+}
@@ -0,0 +1,444 @@
+/**
+ * STM32 串口链路实现，见 stm32_link.h
+ */
+
+#include "stm32_link.h"
+
+void Stm32Link::begin(HardwareSerial& port) {
+    port_ = &port;
+    // UART 事件任务中把字节搬进环形缓冲区，主循环只做 poll()
+    port.onReceive([this]() { pumpUart(); });
+}
+
+void Stm32Link::pumpUart() {
+    while (port_->available()) {
+        uint16_t c = (uint8_t)port_->read();
+        // 缓冲满丢字节时在丢弃位置写入标记，poll() 读到标记时丢弃正在组装的行/帧
+        if (rxGap_ && !rx_.push(STM32_RX_GAP)) {
+            rxOverflows_++;
+            continue;
+        }
+        rxGap_ = false;
+        if (!rx_.push(c)) {
+            rxOverflows_++;
+            rxGap_ = true;
+        }
+    }
+}
+
+void Stm32Link::poll() {
+    uint16_t c;
+    while (rx_.pop(c)) {
+        if (c == STM32_RX_GAP) {
+            // 当前行/帧中间丢了字节，丢弃到下一个分隔符
+            lineDiscard_ = true;
+        } else if (binary_) {
+            feedBinary((uint8_t)c);
+        } else {
+            feed((char)c);
+        }
+    }
+
+    expireTimeouts(millis());
+}
+
+void Stm32Link::feed(char c) {
+    if (c == '\n' || c == '\r') {
+        if (!lineDiscard_ && lineLen_ > 0) {
+            line_[lineLen_] = '\0';
+            dispatch(line_, lineLen_);
+        }
+        lineLen_ = 0;
+        // 刚收到 OK,BIN：其后的 "\n" 等残余字节丢弃到 STM32 发出的第一个 0x00
+        lineDiscard_ = binary_;
+        return;
+    }
+
+    if (lineLen_ < sizeof(line_) - 1) {
+        line_[lineLen_++] = c;
+    } else {
+        lineDiscard_ = true;
+    }
+}
+
+void Stm32Link::feedBinary(uint8_t b) {
+    if (b == 0x00) {
+        Stm32Frame frame;
+        if (!lineDiscard_ && frameLen_ > 0) {
+            if (frameDecode(frameBuf_, frameLen_, &frame)) {
+                dispatchFrame(frame);
+            } else {
+                frameErrors_++;
+            }
+        }
+        frameLen_ = 0;
+        lineDiscard_ = false;
+        return;
+    }
+
+    if (frameLen_ < sizeof(frameBuf_)) {
+        frameBuf_[frameLen_++] = b;
+    } else {
+        lineDiscard_ = true;
+    }
+}
+
+Stm32LineType Stm32Link::classify(const char* line, size_t len) {
+    if ((len >= 2 && strncmp(line, "OK", 2) == 0) ||
+        (len >= 3 && strncmp(line, "ERR", 3) == 0)) {
+        return STM32_LINE_ACK;
+    }
+    if (len >= 6 && strncmp(line, "SENSOR", 6) == 0) {
+        return STM32_LINE_SENSOR;
+    }
+    if (len >= 4 && strncmp(line, "PONG", 4) == 0) {
+        return STM32_LINE_PONG;
+    }
+    return STM32_LINE_OTHER;
+}
+
+void Stm32Link::dispatch(const char* line, size_t len) {
+    switch (classify(line, len)) {
+        case STM32_LINE_ACK:
+            completeAck(line, len);
+            break;
+
+        case STM32_LINE_SENSOR:
+            if (sensorHandler_) sensorHandler_(line, len);
+            break;
+
+        case STM32_LINE_PONG:
+            if (pingOutstanding_) {
+                pingOutstanding_ = false;
+                if (pongHandler_) pongHandler_(true, millis() - pingSentAt_);
+            } else if (pongHandler_) {
+                pongHandler_(true, 0);
+            }
+            break;
+
+        default:
+            if (otherHandler_) otherHandler_(line, len);
+            break;
+    }
+}
+
+void Stm32Link::dispatchFrame(const Stm32Frame& frame) {
+    switch (frame.type) {
+        case FRAME_ACK:
+            completeFrameAck(frame);
+            break;
+
+        case FRAME_SENSOR:
+            if (frame.len >= 3 && sensorDataHandler_) {
+                const uint8_t* p = frame.payload;
+                uint32_t stamp = frame.len >= 7
+                    ? p[3] | (p[4] << 8) | (p[5] << 16) | ((uint32_t)p[6] << 24) : 0;
+                sensorDataHandler_(p[0] | (p[1] << 8), p[2], stamp);
+            }
+            break;
+
+        case FRAME_PONG:
+            dispatch("PONG", 4);
+            break;
+
+        case FRAME_TEXT_REPLY: {
+            // 没有二进制编码的回复（DIST/IR/BEEP 等），按文本行分发
+            size_t n = frame.len < sizeof(line_) - 1 ? frame.len : sizeof(line_) - 1;
+            memcpy(line_, frame.payload, n);
+            line_[n] = '\0';
+            dispatch(line_, n);
+            break;
+        }
+
+        default:
+            frameErrors_++;
+            break;
+    }
+}
+
+// 查询类命令（PING/SENSOR/DIST/IR/TRACK/KEY/ODOM/GOV）的回复不是 OK/ERR；
+// 只比较整条命令，ODOM,RESET / GOV,<参数> 仍回 OK
+bool Stm32Link::expectsAck(const char* line) {
+    static const char* const queries[] = {
+        "PING", "SENSOR", "DIST", "IR", "TRACK", "KEY", "ODOM", "GOV"
+    };
+    for (const char* q : queries) {
+        size_t n = strlen(q);
+        if (strncmp(line, q, n) == 0 && (line[n] == '\n' || line[n] == '\0')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Stm32Link::pushPending(const char* tag, uint8_t seq, uint16_t execMs) {
+    if (pendingCount_ >= STM32_PENDING_MAX) {
+        return false;
+    }
+    unsigned long now = millis();
+    unsigned long start = now;
+    if (pendingCount_ > 0) {
+        const Pending& prev = pending_[(pendingHead_ + pendingCount_ - 1) % STM32_PENDING_MAX];
+        if ((long)(prev.doneAt - now) > 0) start = prev.doneAt;
+    }
+    Pending& p = pending_[(pendingHead_ + pendingCount_) % STM32_PENDING_MAX];
+    size_t n = 0;
+    while (n < sizeof(p.cmd) - 1 && tag[n] && tag[n] != ',' && tag[n] != '\n') {
+        p.cmd[n] = tag[n];
+        n++;
+    }
+    p.cmd[n] = '\0';
+    p.seq = seq;
+    p.sentAt = now;
+    p.doneAt = start + execMs;
+    pendingCount_++;
+    return true;
+}
+
+bool Stm32Link::send(const char* line, uint16_t execMs) {
+    if (port_ && strcmp(line, "S\n") == 0) {
+        sendStop();
+        return true;
+    }
+    // 协商期间 STM32 可能已切换协议，暂停发送
+    if (!port_ || negotiating_) return false;
+
+    if (binary_) {
+        return sendFrame(FRAME_TEXT, (const uint8_t*)line, strcspn(line, "\n"), line,
+                         expectsAck(line));
+    }
+
+    if (expectsAck(line) && !pushPending(line, 0, execMs)) {
+        return false;
+    }
+
+    port_->write((const uint8_t*)line, strlen(line));
+    return true;
+}
+
+bool Stm32Link::sendFrame(uint8_t type, const uint8_t* payload, size_t len,
+                          const char* tag, bool ackExpected) {
+    if (port_ && type == FRAME_STOP && (binary_ || negotiating_)) {
+        sendStop();
+        return true;
+    }
+    if (!port_ || !binary_ || negotiating_) return false;
+
+    uint8_t out[FRAME_MAX_ENCODED];
+    uint8_t seq = txSeq_++;
+    size_t n = frameEncode(type, seq, payload, len, out);
+    if (n == 0) return false;
+
+    if (ackExpected && !pushPending(tag, seq)) {
+        return false;
+    }
+
+    port_->write(out, n);
+    return true;
+}
+
+void Stm32Link::sendStop() {
+    if (!port_) return;
+    if (negotiating_) {
+        // STM32 此时可能已切到二进制，也可能还在文本，两种编码都可能被当成乱码
+        stopHeld_ = true;
+        return;
+    }
+    writeStop();
+}
+
+void Stm32Link::writeStop() {
+    if (binary_) {
+        uint8_t out[FRAME_MAX_ENCODED];
+        uint8_t seq = txSeq_++;
+        size_t n = frameEncode(FRAME_STOP, seq, nullptr, 0, out);
+        pushPending("S", seq);
+        port_->write(out, n);
+    } else {
+        pushPending("S", 0);
+        port_->write((const uint8_t*)"S\n", 2);
+    }
+}
+
+void Stm32Link::flushHeldStop() {
+    if (stopHeld_ && !negotiating_) {
+        stopHeld_ = false;
+        writeStop();
+    }
+}
+
+void Stm32Link::ping() {
+    if (pingOutstanding_ || !port_ || negotiating_) return;
+    pingOutstanding_ = true;
+    pingSentAt_ = millis();
+    if (binary_) {
+        sendFrame(FRAME_PING, nullptr, 0, "PING", false);
+    } else {
+        port_->write((const uint8_t*)"PING\n", 5);
+    }
+}
+
+void Stm32Link::requestBinary() {
+    if (binary_ || negotiating_ || binaryUnsupported_ || !port_) return;
+    if (!pushPending("BIN", 0)) return;
+    negotiating_ = true;
+    port_->write((const uint8_t*)"BIN\n", 4);
+}
+
+void Stm32Link::revertToText() {
+    if (!port_) return;
+    if (binary_) {
+        // STM32 若仍在二进制模式会切回文本；若已复位，这些字节在换行处被丢弃
+        sendFrame(FRAME_TEXT_MODE, nullptr, 0, "TEXT", false);
+        port_->write((const uint8_t*)"\n", 1);
+    }
+    binary_ = false;
+    negotiating_ = false;
+    frameLen_ = 0;
+    lineLen_ = 0;
+    pendingCount_ = 0;
+    flushHeldStop();
+}
+
+// 应答回显的命令名是否与 cmd 一致：OK,<命令>[,...] / ERR,unknown:<命令>。
+// 不带命令名的应答（OK、ERR,range:...、ERR,full）无法核对，视为一致
+bool Stm32Link::ackMatches(const char* cmd, const char* line, size_t len) {
+    const char* end = line + len;
+    const char* echo = (const char*)memchr(line, ',', len);
+    if (!echo) return true;
+    echo++;
+    if (line[0] == 'E') {
+        if (end - echo < 8 || strncmp(echo, "unknown:", 8) != 0) return true;
+        echo += 8;
+        while (echo < end && *echo == ' ') echo++;
+    }
+
+    size_t n = 0;
+    while (echo + n < end && echo[n] != ',') n++;
+    size_t c = strlen(cmd);
+    // 命令名超过 Pending::cmd 时只存了前缀
+    if (n == c || (c == sizeof(Pending::cmd) - 1 && n > c)) {
+        if (memcmp(echo, cmd, c) == 0) return true;
+    }
+
+    // simo_robot（MotionV1Protocol）：M,forward,... → OK,forward,...，S → OK,stop
+    if (strcmp(cmd, "M") == 0) {
+        static const char* const dirs[] = {"forward", "backward", "left", "right"};
+        for (const char* d : dirs) {
+            if (n == strlen(d) && memcmp(echo, d, n) == 0) return true;
+        }
+    }
+    return strcmp(cmd, "S") == 0 && n == 4 && memcmp(echo, "stop", 4) == 0;
+}
+
+// 队首命令没有等到应答（超时，或后面的命令已经应答）
+void Stm32Link::dropPending(unsigned long now) {
+    Pending& p = pending_[pendingHead_];
+    pendingHead_ = (pendingHead_ + 1) % STM32_PENDING_MAX;
+    pendingCount_--;
+    ackTimeouts_++;
+    if (negotiating_ && strcmp(p.cmd, "BIN") == 0) {
+        negotiating_ = false;
+    }
+    if (ackHandler_) ackHandler_(p.cmd, nullptr, 0, now - p.sentAt);
+    flushHeldStop();
+}
+
+void Stm32Link::completeAck(const char* line, size_t len) {
+    // 按回显的命令名匹配：阻塞执行的运动命令回复得晚，已超时命令的迟到应答
+    // 不能算到后面的命令（PING/BIN 等）头上
+    size_t i = 0;
+    while (i < pendingCount_ &&
+           !ackMatches(pending_[(pendingHead_ + i) % STM32_PENDING_MAX].cmd, line, len)) {
+        i++;
+    }
+    if (i == pendingCount_) {
+        // 迟到的应答（已超时）或 STM32 主动发送，只记录
+        lateAcks_++;
+        if (ackHandler_) ackHandler_("", line, len, 0);
+        return;
+    }
+
+    // 排在前面但没有应答的命令视为丢失（STM32 按顺序处理命令）
+    unsigned long now = millis();
+    while (i--) {
+        dropPending(now);
+    }
+
+    size_t n = len < sizeof(lastAck_) - 1 ? len : sizeof(lastAck_) - 1;
+    memcpy(lastAck_, line, n);
+    lastAck_[n] = '\0';
+
+    Pending& p = pending_[pendingHead_];
+    lastAckRtt_ = now - p.sentAt;
+    pendingHead_ = (pendingHead_ + 1) % STM32_PENDING_MAX;
+    pendingCount_--;
+
+    // 协议协商结果：OK,BIN 之后 STM32 发出的都是二进制帧
+    if (negotiating_ && strcmp(p.cmd, "BIN") == 0) {
+        negotiating_ = false;
+        if (strncmp(line, "OK,BIN", 6) == 0) {
+            binary_ = true;
+            frameLen_ = 0;
+        } else {
+            binaryUnsupported_ = true;
+        }
+    }
+
+    if (ackHandler_) ackHandler_(p.cmd, line, len, lastAckRtt_);
+    flushHeldStop();
+}
+
+void Stm32Link::completeFrameAck(const Stm32Frame& frame) {
+    bool ok = frame.len >= 1 && frame.payload[0] == 0;
+
+    bool found = false;
+    for (size_t i = 0; i < pendingCount_; i++) {
+        if (pending_[(pendingHead_ + i) % STM32_PENDING_MAX].seq == frame.seq) {
+            found = true;
+            break;
+        }
+    }
+    if (!found) {
+        // 迟到的应答（已超时），与文本协议一样只计数，不覆盖 lastAck_
+        const char* text = ok ? "OK" : "ERR";
+        lateAcks_++;
+        if (ackHandler_) ackHandler_("", text, strlen(text), 0);
+        return;
+    }
+
+    // 按序号匹配；排在前面但没有应答的命令视为丢失
+    while (pendingCount_ > 0) {
+        Pending& p = pending_[pendingHead_];
+        pendingHead_ = (pendingHead_ + 1) % STM32_PENDING_MAX;
+        pendingCount_--;
+
+        uint32_t rtt = millis() - p.sentAt;
+        if (p.seq != frame.seq) {
+            ackTimeouts_++;
+            if (ackHandler_) ackHandler_(p.cmd, nullptr, 0, rtt);
+            continue;
+        }
+
+        int n = snprintf(lastAck_, sizeof(lastAck_), "%s,%s", ok ? "OK" : "ERR", p.cmd);
+        lastAckRtt_ = rtt;
+        if (ackHandler_) ackHandler_(p.cmd, lastAck_, n, rtt);
+        return;
+    }
+}
+
+void Stm32Link::expireTimeouts(unsigned long now) {
+    while (pendingCount_ > 0) {
+        if ((long)(now - pending_[pendingHead_].doneAt) < STM32_ACK_TIMEOUT_MS) break;
+        dropPending(now);
+    }
+
+    if (pingOutstanding_ && now - pingSentAt_ >= STM32_PONG_TIMEOUT_MS) {
+        pingOutstanding_ = false;
+        // 二进制模式下心跳超时：STM32 可能已复位回到文本模式
+        if (binary_) {
+            revertToText();
+        }
+        if (pongHandler_) pongHandler_(false, now - pingSentAt_);
+    }
+}
@@ -0,0 +1,140 @@
+/**
+ * 遥测历史记录实现，见 telemetry_log.h
+ */
+
+#include "telemetry_log.h"
+
+bool TelemetryLog::begin() {
+    size_t cap = TLOG_CAPACITY;
+    buf_ = psramFound() ? (TelemetryRecord*)ps_malloc(cap * sizeof(TelemetryRecord)) : nullptr;
+    if (!buf_) {
+        cap = TLOG_FALLBACK;
+        buf_ = (TelemetryRecord*)malloc(cap * sizeof(TelemetryRecord));
+    }
+    cap_ = buf_ ? cap : 0;
+    return buf_ != nullptr;
+}
+
+void TelemetryLog::noteCommand(char cmd, uint8_t pwm, uint16_t ms) {
+    pending_.cmd = cmd;
+    pending_.cmdPwm = pwm;
+    pending_.cmdMs = ms;
+    if (pending_.cmdCount < 255) pending_.cmdCount++;
+}
+
+void TelemetryLog::noteAck(uint32_t rttMs, bool timeout) {
+    if (timeout) {
+        if (pending_.timeouts < 255) pending_.timeouts++;
+        return;
+    }
+    if (rttMs == 0) rttMs = 1;          // 0 表示没有应答
+    if (rttMs > 0xFFFF) rttMs = 0xFFFF;
+    if (rttMs > pending_.rttMs) pending_.rttMs = (uint16_t)rttMs;
+}
+
+void TelemetryLog::sample(unsigned long now, int distance, uint8_t flags, uint8_t mode) {
+    if (cap_ == 0 || now - lastSampleAt_ < TLOG_PERIOD_MS) return;
+    lastSampleAt_ = now;
+
+    pending_.ms = now;
+    pending_.distance = distance < 0 ? 0 : distance > 0xFFFF ? 0xFFFF : (uint16_t)distance;
+    pending_.flags = flags;
+    pending_.mode = mode;
+
+    // 先写槽位再发布计数，读者看到计数时记录已完整
+    uint32_t w = written_.load(std::memory_order_relaxed);
+    buf_[w % cap_] = pending_;
+    written_.store(w + 1, std::memory_order_release);
+
+    pending_ = {};
+}
+
+size_t TelemetryLog::size() const {
+    uint32_t w = written_.load(std::memory_order_acquire);
+    return w < cap_ ? w : cap_;
+}
+
+uint32_t TelemetryLog::oldest(uint32_t written) const {
+    // 写者可能正在覆盖 written % cap_，留出这一格
+    return written < cap_ ? 0 : written - cap_ + 1;
+}
+
+// 拷贝后再确认期间没有被写者覆盖（与顺序锁同样的思路）
+bool TelemetryLog::read(uint32_t index, TelemetryRecord* out) const {
+    uint32_t w = written_.load(std::memory_order_acquire);
+    if (index >= w || index < oldest(w)) return false;
+    *out = buf_[index % cap_];
+    std::atomic_thread_fence(std::memory_order_acquire);
+    w = written_.load(std::memory_order_relaxed);
+    return index >= oldest(w);
+}
+
+TelemetryCursor TelemetryLog::seek(uint32_t fromMs, uint32_t toMs, uint32_t bucketMs) const {
+    TelemetryCursor cur = {0, toMs, bucketMs};
+    if (cap_ == 0) return cur;
+
+    // 记录按时间递增，二分查找第一条 ms >= fromMs 的
+    uint32_t w = written_.load(std::memory_order_acquire);
+    uint32_t lo = oldest(w) + 1;        // 多留一格，查找期间最早的记录可能被覆盖
+    uint32_t hi = w;
+    if (lo > hi) lo = hi;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        TelemetryRecord rec;
+        if (!read(mid, &rec) || rec.ms < fromMs) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    cur.index = lo;
+    return cur;
+}
+
+size_t TelemetryLog::next(TelemetryCursor& cur, TelemetryBucket* out, size_t max) const {
+    size_t n = 0;
+    bool open = false;
+    uint32_t key = 0;
+    TelemetryRecord rec;
+
+    if (cap_ == 0) return 0;
+
+    while (true) {
+        uint32_t w = written_.load(std::memory_order_acquire);
+        if (cur.index < oldest(w)) cur.index = oldest(w);    // 读得太慢，跳过已被覆盖的部分
+        if (cur.index >= w) break;
+        if (!read(cur.index, &rec)) continue;
+        if (rec.ms > cur.toMs) break;
+
+        // 同一个桶的记录在一次调用内合并完，桶不会跨调用
+        uint32_t k = cur.bucketMs ? rec.ms / cur.bucketMs : cur.index;
+        if (open && k != key) {
+            n++;
+            open = false;
+            if (n == max) return n;
+        }
+
+        TelemetryBucket& b = out[n];
+        if (!open) {
+            open = true;
+            key = k;
+            b = {};
+            b.ms = cur.bucketMs ? k * cur.bucketMs : rec.ms;
+            b.distMin = b.distMax = rec.distance;
+        }
+        b.count++;
+        if (rec.distance < b.distMin) b.distMin = rec.distance;
+        if (rec.distance > b.distMax) b.distMax = rec.distance;
+        if (rec.rttMs) {
+            if (b.rttMin == 0 || rec.rttMs < b.rttMin) b.rttMin = rec.rttMs;
+            if (rec.rttMs > b.rttMax) b.rttMax = rec.rttMs;
+        }
+        b.flags |= rec.flags;
+        b.mode = rec.mode;
+        if (rec.cmd) b.cmd = rec.cmd;
+        b.cmds = b.cmds + rec.cmdCount > 255 ? 255 : b.cmds + rec.cmdCount;
+        b.timeouts = b.timeouts + rec.timeouts > 255 ? 255 : b.timeouts + rec.timeouts;
+        cur.index++;
+    }
+    return open ? n + 1 : n;
+}
@@ -0,0 +1,236 @@
+/**
+ * WebSocket 遥测推送实现，见 telemetry_ws.h
+ */
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#include "control.h"
+#include "telemetry_ws.h"
+
+static AsyncWebServer wsHttp(WS_PORT);
+static AsyncWebSocket ws("/ws");
+
+// async_tcp 任务 → 网络任务：连接事件
+struct WsEvent {
+    enum Type : uint8_t { CONNECT, DISCONNECT, RATE } type;
+    uint32_t clientId;
+    uint16_t value;
+};
+static SpscRing<WsEvent, 16> wsEvents;
+
+// 每个客户端的推送状态（只在网络任务中访问）
+struct WsSlot {
+    bool used;
+    uint32_t clientId;
+    bool synced;                // 已发送过完整快照
+    ControlStatus lastSent;     // 该客户端已知的状态
+    unsigned long lastPush;
+    uint16_t intervalMs;
+};
+static WsSlot slots[WS_MAX_CLIENTS];
+
+// ============ 上行命令 ============
+static void replyText(AsyncWebSocketClient* client, const char* text) {
+    if (!client->queueIsFull()) {
+        client->text(text);
+    }
+}
+
+static void handleWsCommand(AsyncWebSocketClient* client, char* text) {
+    ControlMsg msg = {};
+
+    if (strncmp(text, "MODE,", 5) == 0) {
+        if (!robotModeFromName(text + 5, &msg.mode)) {
+            replyText(client, "{\"cmd\":\"ERR,mode\"}");
+            return;
+        }
+        msg.type = ControlMsg::MODE;
+    } else if (strncmp(text, "RATE,", 5) == 0) {
+        int hz = atoi(text + 5);
+        if (hz <= 0 || hz > WS_PUSH_MAX_HZ) hz = WS_PUSH_MAX_HZ;
+        WsEvent ev = {WsEvent::RATE, client->id(), (uint16_t)(1000 / hz)};
+        wsEvents.push(ev);
+        replyText(client, "{\"cmd\":\"OK\"}");
+        return;
+    } else if (text[0] == 'V' && text[1] == ',') {
+        // 摇杆设定值流（20~50Hz）：成功不回复，只在出错时回 ERR
+        if (!stm32ParseVelocity(text + 2, &msg.left, &msg.right)) {
+            replyText(client, "{\"cmd\":\"ERR,range\"}");
+        } else {
+            msg.type = ControlMsg::VELOCITY;
+            if (!wsToControl.push(msg)) replyText(client, "{\"cmd\":\"ERR,busy\"}");
+        }
+        return;
+    } else if (text[0] && (text[1] == '\0' || text[1] == ',') &&
+               stm32CmdFromName(text, 1, &msg.cmd)) {
+        // F/B/L/R/S[,<ms>]
+        msg.type = ControlMsg::MOTION;
+        msg.speed = 150;
+        msg.duration = stm32cmd::clampU16(text[1] == ',' ? atoi(text + 2) : 500);
+    } else {
+        replyText(client, "{\"cmd\":\"ERR,unknown\"}");
+        return;
+    }
+
+    replyText(client, wsToControl.push(msg) ? "{\"cmd\":\"OK\"}" : "{\"cmd\":\"ERR,busy\"}");
+}
+
+// async_tcp 任务中执行
+static void onWsEvent(AsyncWebSocket* server, AsyncWebSocketClient* client,
+                      AwsEventType type, void* arg, uint8_t* data, size_t len) {
+    if (type == WS_EVT_CONNECT) {
+        if (server->count() > WS_MAX_CLIENTS) {
+            client->close(1013, "too many clients");
+            return;
+        }
+        WsEvent ev = {WsEvent::CONNECT, client->id(), 0};
+        wsEvents.push(ev);
+        Serial.printf("[WS] 客户端 #%u 已连接\n", client->id());
+    } else if (type == WS_EVT_DISCONNECT) {
+        WsEvent ev = {WsEvent::DISCONNECT, client->id(), 0};
+        wsEvents.push(ev);
+        Serial.printf("[WS] 客户端 #%u 已断开\n", client->id());
+    } else if (type == WS_EVT_DATA) {
+        AwsFrameInfo* info = (AwsFrameInfo*)arg;
+        // 只处理单帧短文本命令
+        if (!info->final || info->index != 0 || info->len != len || info->opcode != WS_TEXT) {
+            return;
+        }
+        char text[32];
+        size_t n = len < sizeof(text) - 1 ? len : sizeof(text) - 1;
+        memcpy(text, data, n);
+        text[n] = '\0';
+        handleWsCommand(client, text);
+    }
+}
+
+// ============ 下行推送 ============
+static WsSlot* findSlot(uint32_t id) {
+    for (WsSlot& s : slots) {
+        if (s.used && s.clientId == id) return &s;
+    }
+    return nullptr;
+}
+
+static void drainEvents() {
+    WsEvent ev;
+    while (wsEvents.pop(ev)) {
+        WsSlot* slot = findSlot(ev.clientId);
+        if (ev.type == WsEvent::CONNECT) {
+            if (!slot) {
+                for (WsSlot& s : slots) {
+                    if (!s.used) { slot = &s; break; }
+                }
+            }
+            if (slot) {
+                *slot = {};
+                slot->used = true;
+                slot->clientId = ev.clientId;
+                slot->intervalMs = 1000 / WS_PUSH_MAX_HZ;
+            }
+        } else if (ev.type == WsEvent::DISCONNECT) {
+            if (slot) slot->used = false;
+        } else if (ev.type == WsEvent::RATE) {
+            if (slot) slot->intervalMs = ev.value;
+        }
+    }
+}
+
+// 追加一个字段到 JSON 对象
+static void appendField(char* buf, size_t size, size_t& pos, const char* fmt, ...) {
+    if (pos >= size - 1) return;
+    if (pos > 1) buf[pos++] = ',';
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf + pos, size - pos, fmt, ap);
+    va_end(ap);
+    if (n > 0) pos += n;
+}
+
+#define JSON_BOOL(b) ((b) ? "true" : "false")
+
+// 生成相对 old 的增量，full=true 时输出全部字段；没有变化返回 0
+static size_t buildDelta(char* buf, size_t size, const ControlStatus& st,
+                         const ControlStatus& old, bool full) {
+    size_t pos = 0;
+    buf[pos++] = '{';
+
+    if (full || st.stm32Connected != old.stm32Connected)
+        appendField(buf, size, pos, "\"stm32\":%s", JSON_BOOL(st.stm32Connected));
+    if (full || st.sensor.distance != old.sensor.distance)
+        appendField(buf, size, pos, "\"distance\":%d", st.sensor.distance);
+    if (full || st.sensor.leftIR != old.sensor.leftIR)
+        appendField(buf, size, pos, "\"leftIR\":%s", JSON_BOOL(st.sensor.leftIR));
+    if (full || st.sensor.rightIR != old.sensor.rightIR)
+        appendField(buf, size, pos, "\"rightIR\":%s", JSON_BOOL(st.sensor.rightIR));
+    if (full || st.sensor.leftTrack != old.sensor.leftTrack)
+        appendField(buf, size, pos, "\"leftTrack\":%s", JSON_BOOL(st.sensor.leftTrack));
+    if (full || st.sensor.rightTrack != old.sensor.rightTrack)
+        appendField(buf, size, pos, "\"rightTrack\":%s", JSON_BOOL(st.sensor.rightTrack));
+    if (full || st.mode != old.mode)
+        appendField(buf, size, pos, "\"mode\":\"%s\"", robotModeName(st.mode));
+    if (full || strcmp(st.lastAck, old.lastAck) != 0)
+        appendField(buf, size, pos, "\"lastAck\":\"%s\"", st.lastAck);
+
+    if (pos == 1 || pos >= size - 1) return 0;
+    buf[pos++] = '}';
+    buf[pos] = '\0';
+    return pos;
+}
+
+void telemetryWsBegin() {
+    ws.onEvent(onWsEvent);
+    wsHttp.addHandler(&ws);
+    wsHttp.begin();
+    Serial.printf("[WS] 遥测推送: ws://<ip>:%d/ws\n", WS_PORT);
+}
+
+void telemetryWsLoop() {
+    drainEvents();
+
+    // 释放已断开的连接占用的内存
+    static unsigned long lastCleanup = 0;
+    if (millis() - lastCleanup >= 1000) {
+        lastCleanup = millis();
+        ws.cleanupClients(WS_MAX_CLIENTS);
+    }
+
+    unsigned long now = millis();
+    bool due = false;
+    for (const WsSlot& s : slots) {
+        if (s.used && now - s.lastPush >= s.intervalMs) due = true;
+    }
+    if (!due) return;
+
+    // 增量相对每个客户端自己的 lastSent 计算，被限速或背压跳过的变化不会丢
+    ControlStatus st = controlStatus.read();
+    char json[320];
+
+    for (WsSlot& s : slots) {
+        if (!s.used || now - s.lastPush < s.intervalMs) continue;
+
+        AsyncWebSocketClient* client = ws.client(s.clientId);
+        if (!client || client->status() != WS_CONNECTED) {
+            s.used = false;
+            continue;
+        }
+        // 背压：该客户端发送队列已满，跳过，增量留到下次
+        if (client->queueIsFull()) {
+            continue;
+        }
+
+        size_t len = buildDelta(json, sizeof(json), st, s.lastSent, !s.synced);
+        if (len == 0) continue;
+
+        client->text(json, len);
+        s.lastSent = st;
+        s.synced = true;
+        s.lastPush = now;
+    }
+}
+
+int telemetryWsClientCount() {
+    return ws.count();
+}
@@ -0,0 +1,177 @@
+/**
+ * 主机原生构建（env:native）用的 Arduino 最小替身
+ *
+ * 只实现固件实际用到的接口：
+ * - millis()/micros()/delay() 走可控的假时钟（native.h 中推进），测试结果不依赖真实时间
+ * - String 用 std::string 实现，语义与 Arduino 一致（indexOf 找不到返回 -1 等）
+ * - HardwareSerial 可以接一个对端（FakeStm32），写入的字节直接交给对端，
+ *   对端注入的字节触发 onReceive 回调，与 ESP32 的 UART 事件任务一致
+ * - Serial（调试串口）默认不输出，SIMO_NATIVE_VERBOSE=1 时打印到 stdout
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <deque>
+#include <functional>
+#include <string>
+#include "freertos_shim.h"
+
+typedef uint8_t byte;
+
+#define HIGH            1
+#define LOW             0
+#define INPUT           0
+#define OUTPUT          1
+#define PROGMEM
+#define SERIAL_8N1      0x800001c
+
+#define PI              3.1415926535897932384626433832795
+#define DEG_TO_RAD      0.017453292519943295769236907684886
+#define RAD_TO_DEG      57.295779513082320876798154814105
+#define radians(deg)    ((deg) * DEG_TO_RAD)
+#define degrees(rad)    ((rad) * RAD_TO_DEG)
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+long random(long max);
+
+inline bool isDigit(int c) { return c >= '0' && c <= '9'; }
+
+// ============ String ============
+class String {
+public:
+    String() {}
+    String(const char* s) : s_(s ? s : "") {}
+    String(const std::string& s) : s_(s) {}
+    String(char c) : s_(1, c) {}
+    String(int v) : s_(std::to_string(v)) {}
+    String(unsigned int v) : s_(std::to_string(v)) {}
+    String(long v) : s_(std::to_string(v)) {}
+    String(unsigned long v) : s_(std::to_string(v)) {}
+
+    unsigned int length() const { return s_.size(); }
+    const char* c_str() const { return s_.c_str(); }
+    char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+    char operator[](unsigned int i) const { return charAt(i); }
+
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const char* s, unsigned int from = 0) const;
+    int indexOf(const String& s, unsigned int from = 0) const { return indexOf(s.c_str(), from); }
+    int lastIndexOf(char c) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+    bool startsWith(const char* prefix) const { return s_.compare(0, strlen(prefix), prefix) == 0; }
+    bool startsWith(const String& prefix) const { return startsWith(prefix.c_str()); }
+    bool endsWith(const char* suffix) const;
+    long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(s_.c_str(), nullptr); }
+    void trim();
+    void toUpperCase();
+    void toLowerCase();
+    void reserve(unsigned int n) { s_.reserve(n); }
+
+    bool operator==(const String& o) const { return s_ == o.s_; }
+    bool operator==(const char* o) const { return s_ == (o ? o : ""); }
+    bool operator!=(const String& o) const { return s_ != o.s_; }
+    bool operator!=(const char* o) const { return !(*this == o); }
+    bool operator<(const String& o) const { return s_ < o.s_; }
+
+    String& operator+=(const String& o) { s_ += o.s_; return *this; }
+    String& operator+=(const char* o) { s_ += o ? o : ""; return *this; }
+    String& operator+=(char c) { s_ += c; return *this; }
+    String& operator+=(int v) { s_ += std::to_string(v); return *this; }
+    String& operator+=(unsigned long v) { s_ += std::to_string(v); return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+    friend String operator+(const String& a, const char* b) { return String(a.s_ + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String((a ? a : "") + b.s_); }
+
+    const std::string& std() const { return s_; }
+
+private:
+    std::string s_;
+};
+
+// ============ Print / Stream ============
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) { return write(&c, 1); }
+    virtual size_t write(const uint8_t* buf, size_t len) = 0;
+    size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    size_t print(const char* s) { return write(s); }
+    size_t print(const String& s) { return write(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v);
+    size_t println(const char* s = "");
+    size_t println(const String& s) { return println(s.c_str()); }
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    String readStringUntil(char terminator);
+};
+
+// 串口：rx 队列 + 可选对端
+class HardwareSerial : public Stream {
+public:
+    // 对端收到 ESP32 写出的字节
+    typedef std::function<void(const uint8_t*, size_t)> PeerWrite;
+
+    explicit HardwareSerial(int uart = 0) : uart_(uart) {}
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int rxPin = -1, int txPin = -1);
+    void onReceive(std::function<void(void)> cb, bool onlyOnTimeout = false) { onReceive_ = cb; }
+    size_t setRxBufferSize(size_t n) { return n; }
+    size_t setTxBufferSize(size_t n) { return n; }
+
+    int available() override { return (int)rx_.size(); }
+    int read() override;
+    using Print::write;
+    size_t write(const uint8_t* buf, size_t len) override;
+    void flush() {}
+
+    // ---- 主机侧 ----
+    void attachPeer(PeerWrite peer) { peer_ = peer; }
+    // 对端发来的字节：进入 rx 队列并触发 onReceive
+    void inject(const uint8_t* buf, size_t len);
+
+private:
+    int uart_;
+    std::deque<uint8_t> rx_;
+    std::function<void(void)> onReceive_;
+    PeerWrite peer_;
+};
+
+extern HardwareSerial Serial;
+
+// ============ ESP ============
+class EspClass {
+public:
+    const char* getChipModel() { return "native"; }
+    uint8_t getChipCores() { return 2; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getFlashChipSize() { return 16u << 20; }
+    uint32_t getPsramSize() { return 8u << 20; }
+    uint32_t getFreeHeap() { return 300u << 10; }
+    uint32_t getMinFreeHeap() { return 250u << 10; }
+    uint32_t getFreePsram() { return 6u << 20; }
+    void restart();
+};
+
+extern EspClass ESP;
+
+bool psramFound();
+void* ps_malloc(size_t size);
@@ -0,0 +1,15 @@
+/**
+ * DNSServer 替身（env:native）
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "IPAddress.h"
+
+class DNSServer {
+public:
+    bool start(uint16_t port, const String& domain, const IPAddress& ip) { return true; }
+    void processNextRequest() {}
+    void stop() {}
+};
@@ -0,0 +1,27 @@
+/**
+ * HTTPClient 替身（env:native）：所有请求都返回连接失败
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#define HTTP_CODE_OK                200
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+class HTTPClient {
+public:
+    bool begin(const String& url) { return true; }
+    void addHeader(const String& name, const String& value) {}
+    void setTimeout(uint16_t ms) {}
+    int GET() { return HTTPC_ERROR_CONNECTION_REFUSED; }
+    int POST(const String& payload) { return HTTPC_ERROR_CONNECTION_REFUSED; }
+    int getSize() { return -1; }
+    String getString() { return String(); }
+    WiFiClient* getStreamPtr() { return &client_; }
+    void end() {}
+
+private:
+    WiFiClient client_;
+};
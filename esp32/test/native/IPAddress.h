@@ -0,0 +1,21 @@
+/**
+ * IPAddress 替身（env:native）
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+class IPAddress {
+public:
+    IPAddress() : a_{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : a_{a, b, c, d} {}
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", a_[0], a_[1], a_[2], a_[3]);
+        return String(buf);
+    }
+
+private:
+    uint8_t a_[4];
+};
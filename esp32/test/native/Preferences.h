@@ -0,0 +1,20 @@
+/**
+ * Preferences 替身（env:native）：进程内的键值表，不落盘
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <map>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false) { ns_ = name; return true; }
+    void end() {}
+    bool clear();
+    String getString(const char* key, const String& def = String());
+    size_t putString(const char* key, const String& value);
+
+private:
+    std::string ns_;
+};
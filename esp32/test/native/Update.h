@@ -0,0 +1,26 @@
+/**
+ * OTA Update 替身（env:native）：接受并丢弃写入的数据
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+class UpdateClass {
+public:
+    bool begin(size_t size = UPDATE_SIZE_UNKNOWN) { written_ = 0; return true; }
+    size_t write(uint8_t* data, size_t len) { written_ += len; return len; }
+    size_t writeStream(Stream& s) { return 0; }
+    bool end(bool evenIfRemaining = false) { return true; }
+    bool isFinished() { return true; }
+    bool hasError() { return false; }
+    const char* errorString() { return "native"; }
+    void printError(Print& out) { out.println("native"); }
+
+private:
+    size_t written_ = 0;
+};
+
+extern UpdateClass Update;
@@ -0,0 +1,96 @@
+/**
+ * WebServer 替身（env:native）
+ *
+ * 记录 on() 注册的路由；测试通过 native::request() 直接调用处理函数，
+ * 参数、请求头、响应码、响应头、响应体（含 sendContent 分块）都在进程内传递，不走网络。
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <map>
+#include <utility>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_DELETE };
+enum HTTPUploadStatus { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED };
+
+struct HTTPUpload {
+    HTTPUploadStatus status;
+    String filename;
+    String name;
+    String type;
+    size_t totalSize;
+    size_t currentSize;
+    uint8_t buf[1436];
+};
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    explicit WebServer(int port = 80) {}
+
+    void on(const char* uri, THandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+    void on(const char* uri, HTTPMethod method, THandlerFunction fn);
+    void on(const char* uri, HTTPMethod method, THandlerFunction fn, THandlerFunction upload);
+    void onNotFound(THandlerFunction fn) { notFound_ = fn; }
+    void begin() {}
+    void handleClient() {}
+
+    String arg(const char* name) const;
+    String arg(const String& name) const { return arg(name.c_str()); }
+    bool hasArg(const char* name) const;
+    bool hasArg(const String& name) const { return hasArg(name.c_str()); }
+    void collectHeaders(const char* keys[], size_t count) {}
+    String header(const char* name) const;
+    bool hasHeader(const char* name) const;
+    String uri() const { return uri_; }
+    HTTPMethod method() const { return method_; }
+    HTTPUpload& upload() { return upload_; }
+
+    void sendHeader(const String& name, const String& value, bool first = false) {
+        headers_.push_back({name.std(), value.std()});
+    }
+    void setContentLength(size_t len) {}
+    void send(int code, const char* type = nullptr, const String& body = String());
+    void send(int code, const char* type, const char* body) { send(code, type, String(body)); }
+    void send_P(int code, const char* type, const char* body, size_t len);
+    void sendContent(const String& s) { sendContent(s.c_str(), s.length()); }
+    void sendContent(const char* s) { sendContent(s, strlen(s)); }
+    void sendContent(const char* s, size_t len) { body_.append(s, len); }
+
+    // ---- 主机侧：见 native::request() ----
+    typedef std::vector<std::pair<std::string, std::string>> Pairs;
+    struct Response {
+        int code;
+        std::string type;
+        std::string body;
+        Pairs headers;
+        // 响应头，没有返回空串
+        std::string header(const char* name) const;
+    };
+    bool dispatch(const char* uri, HTTPMethod method, const Pairs& args, const Pairs& headers,
+                  Response* out);
+
+private:
+    struct Route {
+        HTTPMethod method;
+        THandlerFunction fn;
+    };
+
+    std::map<std::string, Route> routes_;
+    THandlerFunction notFound_;
+    Pairs args_;
+    Pairs requestHeaders_;
+    Pairs headers_;
+    String uri_;
+    HTTPMethod method_ = HTTP_GET;
+    HTTPUpload upload_ = {};
+    int code_ = 0;
+    std::string type_;
+    std::string body_;
+};
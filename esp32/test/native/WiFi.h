@@ -0,0 +1,38 @@
+/**
+ * WiFi 替身（env:native）：AP 始终可用，STA 永远连不上（不触发后端注册/OTA）
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "IPAddress.h"
+
+#define WIFI_AP         2
+#define WIFI_AP_STA     3
+#define WL_CONNECTED    3
+#define WL_DISCONNECTED 6
+
+class WiFiClient : public Stream {
+public:
+    int available() override { return 0; }
+    int read() override { return -1; }
+    size_t write(const uint8_t* buf, size_t len) override { return len; }
+};
+
+class WiFiClass {
+public:
+    bool mode(int m) { return true; }
+    bool softAP(const char* ssid, const char* password) { return true; }
+    IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+    IPAddress localIP() { return IPAddress(); }
+    int begin(const char* ssid, const char* password) { return WL_DISCONNECTED; }
+    int status() { return WL_DISCONNECTED; }
+    String macAddress() { return "02:00:00:00:00:01"; }
+    String softAPmacAddress() { return "02:00:00:00:00:02"; }
+    int scanNetworks() { return 0; }
+    String SSID(int i) { return ""; }
+    int32_t RSSI(int i) { return 0; }
+    void scanDelete() {}
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,245 @@
+/**
+ * 进程内的假 STM32，见 fake_stm32.h
+ */
+
+#include "fake_stm32.h"
+#include "native.h"
+
+FakeStm32::FakeStm32(HardwareSerial& port) : port_(port) {
+    port_.attachPeer([this](const uint8_t* data, size_t len) { onBytes(data, len); });
+    hook_ = native::onAdvance([this](unsigned long nowMs) { tick(nowMs); });
+}
+
+FakeStm32::~FakeStm32() {
+    port_.attachPeer(nullptr);
+    native::removeAdvance(hook_);
+}
+
+void FakeStm32::reset() {
+    binary_ = false;
+    streamHz_ = 0;
+    busy_ = false;
+    backlog_.clear();
+    line_.clear();
+    frame_.clear();
+}
+
+size_t FakeStm32::count(const char* prefix) const {
+    size_t n = 0;
+    for (const auto& c : commands) {
+        if (c.compare(0, strlen(prefix), prefix) == 0) n++;
+    }
+    return n;
+}
+
+std::string FakeStm32::last(const char* prefix) const {
+    for (auto it = commands.rbegin(); it != commands.rend(); ++it) {
+        if (it->compare(0, strlen(prefix), prefix) == 0) return *it;
+    }
+    return std::string();
+}
+
+// ============ 接收 ============
+void FakeStm32::onBytes(const uint8_t* data, size_t len) {
+    if (silent) return;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = data[i];
+        if (binary_) {
+            if (b != 0x00) {
+                frame_.push_back(b);
+                continue;
+            }
+            Stm32Frame frame;
+            if (!frame_.empty() && frameDecode(frame_.data(), frame_.size(), &frame)) {
+                handleFrame(frame);
+            }
+            frame_.clear();
+        } else {
+            if (b != '\n' && b != '\r') {
+                line_ += (char)b;
+                continue;
+            }
+            if (!line_.empty()) {
+                std::string line;
+                line.swap(line_);
+                if (busy_) {
+                    backlog_.push_back(line);
+                } else {
+                    handleText(line, 0, false);
+                }
+            }
+        }
+    }
+}
+
+// 与 simo_full 的 ProcessCommand 一致的回复
+void FakeStm32::handleText(const std::string& line, uint8_t seq, bool framed) {
+    static const char* const accepted[] = {
+        "BEEP", "TEMP,", "RAMP,", "ESTOP,", "GOV", "LINE,", "LINECFG,", "LOOP,", "PID,", "ODOM",
+        "DEADMAN,"
+    };
+
+    commands.push_back(line);
+
+    if (line == "S" || line == "SA") {
+        replyText("OK," + line, seq, framed);
+    } else if (line == "PING") {
+        replyText("PONG", seq, framed);
+    } else if (line == "SENSOR") {
+        // simo_full 对 TEXT 帧里的 SENSOR 也回文本行（装在 TEXT_REPLY 中）
+        replyText(sensorLine(millis()), seq, framed);
+    } else if (line.compare(0, 7, "STREAM,") == 0 && supportsStream) {
+        streamHz_ = atoi(line.c_str() + 7);
+        nextStreamAt_ = millis();
+        replyText("OK,STREAM," + std::to_string(streamHz_), seq, framed);
+    } else if (line == "BIN" && supportsBinary && !framed) {
+        static const uint8_t delimiter = 0x00;
+        replyText("OK,BIN", seq, framed);
+        port_.inject(&delimiter, 1);
+        binary_ = true;
+        frame_.clear();
+    } else if (line.size() >= 3 && line[1] == ',' && strchr("FBLR", line[0])) {
+        std::string reply = "OK," + line.substr(0, 2) + std::to_string(atoi(line.c_str() + 2));
+        if (blockingMoves && !framed) {
+            busy_ = true;
+            busyUntil_ = millis() + atoi(line.c_str() + 2);
+            busyReply_ = reply;
+            return;
+        }
+        replyText(reply, seq, framed);
+    } else if (line.compare(0, 2, "V,") == 0) {
+        replyText("OK," + line, seq, framed);
+    } else if (line == "GOV") {
+        replyText("GOV,0,100,1000,0", seq, framed);
+    } else if (line == "ODOM") {
+        replyText("ODOM,0,0,0,0,0", seq, framed);
+    } else if (line.compare(0, 4, "SEQ,") == 0) {
+        replyText("OK,SEQ", seq, framed);
+    } else {
+        for (const char* a : accepted) {
+            if (line.compare(0, strlen(a), a) == 0) {
+                replyText("OK," + line, seq, framed);
+                return;
+            }
+        }
+        replyText("ERR,unknown:" + line, seq, framed);
+    }
+}
+
+void FakeStm32::handleFrame(const Stm32Frame& frame) {
+    const uint8_t* p = frame.payload;
+    uint8_t ack[2] = {0, frame.type};
+
+    switch (frame.type) {
+        case FRAME_MOVE: {
+            if (frame.len < 4 || !strchr("FBLR", p[0])) {
+                commands.push_back("MOVE?");
+                ack[0] = 1;
+                break;
+            }
+            char text[16];
+            snprintf(text, sizeof(text), "%c,%u", p[0], p[2] | (p[3] << 8));
+            commands.push_back(text);
+            lastPwm = p[1];
+            break;
+        }
+        case FRAME_VEL: {
+            if (frame.len < 2) {
+                commands.push_back("VEL?");
+                ack[0] = 1;
+                break;
+            }
+            commands.push_back("V," + std::to_string((int8_t)p[0]) + "," + std::to_string((int8_t)p[1]));
+            break;
+        }
+        case FRAME_STOP:
+            commands.push_back("S");
+            break;
+        case FRAME_PING:
+            commands.push_back("PING");
+            replyFrame(FRAME_PONG, frame.seq, nullptr, 0);
+            return;
+        case FRAME_SENSOR_REQ:
+            commands.push_back("SENSOR");
+            sendSensor(frame.seq);
+            return;
+        case FRAME_TEXT:
+            handleText(std::string((const char*)p, frame.len), frame.seq, true);
+            return;
+        case FRAME_TEXT_MODE:
+            commands.push_back("TEXT_MODE");
+            replyFrame(FRAME_ACK, frame.seq, ack, sizeof(ack));
+            binary_ = false;
+            line_.clear();
+            return;
+        default:
+            ack[0] = 1;
+            break;
+    }
+    replyFrame(FRAME_ACK, frame.seq, ack, sizeof(ack));
+}
+
+// ============ 发送 ============
+void FakeStm32::replyText(const std::string& text, uint8_t seq, bool framed) {
+    if (framed) {
+        replyFrame(FRAME_TEXT_REPLY, seq, (const uint8_t*)text.data(), text.size());
+        return;
+    }
+    std::string line = text + "\r\n";
+    port_.inject((const uint8_t*)line.data(), line.size());
+}
+
+void FakeStm32::replyFrame(uint8_t type, uint8_t seq, const uint8_t* payload, size_t len) {
+    uint8_t out[FRAME_MAX_ENCODED];
+    size_t n = frameEncode(type, seq, payload, len, out);
+    if (n) port_.inject(out, n);
+}
+
+void FakeStm32::sendSensor(uint8_t seq) {
+    uint32_t t = millis();
+    uint8_t payload[7] = {
+        (uint8_t)(distance & 0xFF),
+        (uint8_t)(distance >> 8),
+        (uint8_t)((obsLeft ? 0 : SENSOR_FLAG_OBS_L) | (obsRight ? 0 : SENSOR_FLAG_OBS_R) |
+                  (trackLeft ? SENSOR_FLAG_TRK_L : 0) | (trackRight ? SENSOR_FLAG_TRK_R : 0) |
+                  (distanceValid ? 0 : SENSOR_FLAG_DIST_BAD)),
+        (uint8_t)(t & 0xFF),
+        (uint8_t)((t >> 8) & 0xFF),
+        (uint8_t)((t >> 16) & 0xFF),
+        (uint8_t)(t >> 24)
+    };
+    replyFrame(FRAME_SENSOR, seq, payload, sizeof(payload));
+}
+
+// 阻塞的运动命令执行完：回复，再依次处理期间收到的命令
+void FakeStm32::runBacklog(unsigned long nowMs) {
+    while (busy_ && !silent && (long)(nowMs - busyUntil_) >= 0) {
+        busy_ = false;
+        replyText(busyReply_, 0, false);
+        while (!busy_ && !backlog_.empty()) {
+            std::string line = backlog_.front();
+            backlog_.erase(backlog_.begin());
+            handleText(line, 0, false);
+        }
+    }
+}
+
+// 传感器流：文本模式发 SENSOR 行，二进制模式发 SENSOR 帧（seq=0）
+void FakeStm32::tick(unsigned long nowMs) {
+    runBacklog(nowMs);
+    if (streamHz_ <= 0 || silent || (long)(nowMs - nextStreamAt_) < 0) return;
+    nextStreamAt_ = nowMs + 1000 / streamHz_;
+    if (binary_) {
+        sendSensor(0);
+    } else {
+        replyText(sensorLine(nowMs), 0, false);
+    }
+}
+
+std::string FakeStm32::sensorLine(unsigned long t) const {
+    char buf[80];
+    snprintf(buf, sizeof(buf), "SENSOR,D%u,OL%dOR%d,TL%uTR%u,T%lu,V%d",
+             distance, obsLeft ? 0 : 1, obsRight ? 0 : 1, trackLeft, trackRight,
+             t, distanceValid ? 1 : 0);
+    return buf;
+}
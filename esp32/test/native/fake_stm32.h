@@ -0,0 +1,75 @@
+/**
+ * 进程内的假 STM32（仿 simo_full 固件的串口行为）
+ *
+ * 接在 HardwareSerial 替身的另一端，同步应答 ESP32 发来的命令：
+ * - 文本协议：PING → PONG，SENSOR → SENSOR 行，运动/设置命令 → OK,<命令>，
+ *   其他 → ERR,unknown:<命令>
+ * - BIN 协商后切换到二进制帧（stm32_frame.h），TEXT_MODE 切回文本
+ * - STREAM,<hz> 开启后随假时钟推进主动上报传感器
+ * - blockingMoves：仿 simo_robot_simple，文本运动命令阻塞执行，执行完才回复 OK，
+ *   期间收到的命令排队，执行完再依次处理
+ * 收到的命令按文本形式记录在 commands 中（二进制帧也换算成等价文本，如 MOVE → "F,500"、
+ * VEL → "V,60,-40"）。
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+#include "stm32_frame.h"
+
+class FakeStm32 {
+public:
+    explicit FakeStm32(HardwareSerial& port);
+    ~FakeStm32();
+
+    // ---- 传感器状态（下一次上报时使用） ----
+    uint16_t distance = 1000;       // 0.1cm
+    bool distanceValid = true;
+    bool obsLeft = false, obsRight = false;     // 红外避障（true=检测到障碍，上报为低电平）
+    uint8_t trackLeft = 1, trackRight = 1;      // 循迹原始电平
+
+    // ---- 固件能力 ----
+    bool supportsBinary = true;
+    bool supportsStream = true;
+    bool silent = false;            // 收不到也不回复（模拟断线）
+    bool blockingMoves = false;     // 运动命令执行完才回复（simo_robot_simple）
+
+    // 模拟复位：回到文本协议，关闭传感器流
+    void reset();
+    bool binary() const { return binary_; }
+    int streamHz() const { return streamHz_; }
+
+    // 收到的命令（文本形式），以及最近一条 MOVE 帧的 pwm
+    std::vector<std::string> commands;
+    uint8_t lastPwm = 0;
+    // 以 prefix 开头的命令数
+    size_t count(const char* prefix) const;
+    // 最后一条以 prefix 开头的命令，没有返回空串
+    std::string last(const char* prefix = "") const;
+
+private:
+    void onBytes(const uint8_t* data, size_t len);
+    void handleText(const std::string& line, uint8_t seq, bool framed);
+    void handleFrame(const Stm32Frame& frame);
+    void replyText(const std::string& text, uint8_t seq, bool framed);
+    void replyFrame(uint8_t type, uint8_t seq, const uint8_t* payload, size_t len);
+    void sendSensor(uint8_t seq);
+    std::string sensorLine(unsigned long t) const;
+    void tick(unsigned long nowMs);
+    void runBacklog(unsigned long nowMs);
+
+    HardwareSerial& port_;
+    int hook_;
+    bool binary_ = false;
+    int streamHz_ = 0;
+    unsigned long nextStreamAt_ = 0;
+    uint8_t streamSeq_ = 0;
+    std::string line_;
+    bool busy_ = false;             // 阻塞执行运动命令中
+    unsigned long busyUntil_ = 0;
+    std::string busyReply_;
+    std::vector<std::string> backlog_;
+    std::vector<uint8_t> frame_;
+};
@@ -0,0 +1,28 @@
+/**
+ * FreeRTOS 替身（env:native）
+ *
+ * 原生构建不创建任务：xTaskCreatePinnedToCore 只记录任务函数，
+ * 测试直接调用 controlTick() 等单步函数，执行顺序完全确定。
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+typedef void* TaskHandle_t;
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdTRUE              1
+#define pdFALSE             0
+#define pdPASS              1
+#define portMAX_DELAY       0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms)   (ms)
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* arg,
+                                   unsigned priority, TaskHandle_t* handle, int core);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t wait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+void vTaskDelete(TaskHandle_t task);
@@ -0,0 +1,322 @@
+/**
+ * 主机原生构建的 Arduino/ESP-IDF 替身实现（env:native）
+ */
+
+#include <Arduino.h>
+#include <DNSServer.h>
+#include <Preferences.h>
+#include <Update.h>
+#include <WebServer.h>
+#include <WiFi.h>
+#include <esp_timer.h>
+#include <stdarg.h>
+#include <strings.h>
+#include <map>
+#include <vector>
+#include "native.h"
+
+// ============ 假时钟 ============
+static uint64_t nowUs = 0;
+static std::map<int, std::function<void(unsigned long)>> advanceHooks;
+static int nextHookId = 0;
+static size_t taskCount = 0;
+
+static bool verbose() {
+    static int v = -1;
+    if (v < 0) {
+        const char* env = getenv("SIMO_NATIVE_VERBOSE");
+        v = env && env[0] == '1';
+    }
+    return v == 1;
+}
+
+namespace native {
+
+void advanceUs(uint64_t us) {
+    nowUs += us;
+    // 回调中可能注销自己，先复制一份
+    std::vector<std::function<void(unsigned long)>> hooks;
+    for (auto& h : advanceHooks) hooks.push_back(h.second);
+    for (auto& fn : hooks) fn((unsigned long)(nowUs / 1000));
+}
+
+int onAdvance(std::function<void(unsigned long nowMs)> fn) {
+    advanceHooks[nextHookId] = fn;
+    return nextHookId++;
+}
+
+void removeAdvance(int id) {
+    advanceHooks.erase(id);
+}
+
+WebServer::Response request(WebServer& server, const char* uri, const Args& args,
+                            HTTPMethod method, const Args& headers) {
+    WebServer::Response resp = {404, "text/plain", "", {}};
+    server.dispatch(uri, method, args, headers, &resp);
+    return resp;
+}
+
+size_t tasksCreated() {
+    return taskCount;
+}
+
+}  // namespace native
+
+unsigned long millis() { return (unsigned long)(nowUs / 1000); }
+unsigned long micros() { return (unsigned long)nowUs; }
+void delay(unsigned long ms) { native::advanceMs(ms); }
+void delayMicroseconds(unsigned int us) { native::advanceUs(us); }
+
+static uint8_t pinLevels[64];
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t val) { if (pin < sizeof(pinLevels)) pinLevels[pin] = val; }
+int digitalRead(uint8_t pin) { return pin < sizeof(pinLevels) ? pinLevels[pin] : LOW; }
+long random(long max) { return max > 0 ? rand() % max : 0; }
+
+// ============ String ============
+int String::indexOf(char c, unsigned int from) const {
+    size_t i = s_.find(c, from);
+    return i == std::string::npos ? -1 : (int)i;
+}
+
+int String::indexOf(const char* s, unsigned int from) const {
+    size_t i = s_.find(s, from);
+    return i == std::string::npos ? -1 : (int)i;
+}
+
+int String::lastIndexOf(char c) const {
+    size_t i = s_.rfind(c);
+    return i == std::string::npos ? -1 : (int)i;
+}
+
+String String::substring(unsigned int from) const {
+    return from < s_.size() ? String(s_.substr(from)) : String();
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s_.size()) return String();
+    return String(s_.substr(from, to - from));
+}
+
+bool String::endsWith(const char* suffix) const {
+    size_t n = strlen(suffix);
+    return s_.size() >= n && s_.compare(s_.size() - n, n, suffix) == 0;
+}
+
+void String::trim() {
+    size_t b = s_.find_first_not_of(" \t\r\n");
+    size_t e = s_.find_last_not_of(" \t\r\n");
+    s_ = b == std::string::npos ? std::string() : s_.substr(b, e - b + 1);
+}
+
+void String::toUpperCase() {
+    for (auto& c : s_) if (c >= 'a' && c <= 'z') c -= 32;
+}
+
+void String::toLowerCase() {
+    for (auto& c : s_) if (c >= 'A' && c <= 'Z') c += 32;
+}
+
+// ============ Print / Stream ============
+size_t Print::print(int v) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%d", v);
+    return write(buf);
+}
+
+size_t Print::println(const char* s) {
+    return write(s) + write("\r\n");
+}
+
+size_t Print::printf(const char* fmt, ...) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    if ((size_t)n < sizeof(buf)) return write((const uint8_t*)buf, n);
+
+    std::vector<char> big(n + 1);
+    va_start(ap, fmt);
+    vsnprintf(big.data(), big.size(), fmt, ap);
+    va_end(ap);
+    return write((const uint8_t*)big.data(), n);
+}
+
+String Stream::readStringUntil(char terminator) {
+    std::string s;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) s += (char)c;
+    return String(s);
+}
+
+// ============ HardwareSerial ============
+HardwareSerial Serial(0);
+
+void HardwareSerial::begin(unsigned long baud, uint32_t config, int rxPin, int txPin) {}
+
+int HardwareSerial::read() {
+    if (rx_.empty()) return -1;
+    int c = rx_.front();
+    rx_.pop_front();
+    return c;
+}
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t len) {
+    if (peer_) {
+        peer_(buf, len);
+    } else if (this == &Serial && verbose()) {
+        fwrite(buf, 1, len, stdout);
+    }
+    return len;
+}
+
+void HardwareSerial::inject(const uint8_t* buf, size_t len) {
+    rx_.insert(rx_.end(), buf, buf + len);
+    if (onReceive_) onReceive_();
+}
+
+// ============ ESP / PSRAM ============
+EspClass ESP;
+
+void EspClass::restart() {
+    fprintf(stderr, "[native] ESP.restart()\n");
+    exit(0);
+}
+
+// 按 N16R8 模组处理：有 PSRAM，分配走普通堆
+bool psramFound() { return true; }
+void* ps_malloc(size_t size) { return malloc(size); }
+
+// ============ 网络相关全局对象 ============
+WiFiClass WiFi;
+UpdateClass Update;
+
+static std::map<std::string, std::string> prefsStore;
+
+bool Preferences::clear() {
+    std::string prefix = ns_ + "/";
+    for (auto it = prefsStore.begin(); it != prefsStore.end();) {
+        it = it->first.compare(0, prefix.size(), prefix) == 0 ? prefsStore.erase(it) : std::next(it);
+    }
+    return true;
+}
+
+String Preferences::getString(const char* key, const String& def) {
+    auto it = prefsStore.find(ns_ + "/" + key);
+    return it == prefsStore.end() ? def : String(it->second);
+}
+
+size_t Preferences::putString(const char* key, const String& value) {
+    prefsStore[ns_ + "/" + key] = value.std();
+    return value.length();
+}
+
+// ============ WebServer ============
+void WebServer::on(const char* uri, HTTPMethod method, THandlerFunction fn) {
+    routes_[uri] = Route{method, fn};
+}
+
+void WebServer::on(const char* uri, HTTPMethod method, THandlerFunction fn, THandlerFunction upload) {
+    routes_[uri] = Route{method, fn};
+}
+
+String WebServer::arg(const char* name) const {
+    for (const auto& a : args_) {
+        if (a.first == name) return String(a.second);
+    }
+    return String();
+}
+
+bool WebServer::hasArg(const char* name) const {
+    for (const auto& a : args_) {
+        if (a.first == name) return true;
+    }
+    return false;
+}
+
+void WebServer::send(int code, const char* type, const String& body) {
+    code_ = code;
+    type_ = type ? type : "";
+    body_ += body.std();
+}
+
+void WebServer::send_P(int code, const char* type, const char* body, size_t len) {
+    code_ = code;
+    type_ = type ? type : "";
+    body_.append(body, len);
+}
+
+String WebServer::header(const char* name) const {
+    for (const auto& h : requestHeaders_) {
+        if (strcasecmp(h.first.c_str(), name) == 0) return String(h.second);
+    }
+    return String();
+}
+
+bool WebServer::hasHeader(const char* name) const {
+    for (const auto& h : requestHeaders_) {
+        if (strcasecmp(h.first.c_str(), name) == 0) return true;
+    }
+    return false;
+}
+
+std::string WebServer::Response::header(const char* name) const {
+    for (const auto& h : headers) {
+        if (strcasecmp(h.first.c_str(), name) == 0) return h.second;
+    }
+    return std::string();
+}
+
+bool WebServer::dispatch(const char* uri, HTTPMethod method, const Pairs& args, const Pairs& headers,
+                         Response* out) {
+    auto it = routes_.find(uri);
+    THandlerFunction fn;
+    if (it != routes_.end() && (it->second.method == HTTP_ANY || it->second.method == method)) {
+        fn = it->second.fn;
+    } else if (notFound_) {
+        fn = notFound_;
+    } else {
+        return false;
+    }
+
+    args_ = args;
+    requestHeaders_ = headers;
+    headers_.clear();
+    uri_ = uri;
+    method_ = method;
+    code_ = 0;
+    type_.clear();
+    body_.clear();
+    fn();
+
+    out->code = code_;
+    out->type = type_;
+    out->body = body_;
+    out->headers = headers_;
+    return true;
+}
+
+// ============ FreeRTOS / esp_timer ============
+// 任务不会运行，测试直接调用 controlTick()
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* arg,
+                                   unsigned priority, TaskHandle_t* handle, int core) {
+    taskCount++;
+    if (handle) *handle = (TaskHandle_t)fn;
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t wait) { return 1; }
+BaseType_t xTaskNotifyGive(TaskHandle_t task) { return pdPASS; }
+void vTaskDelay(TickType_t ticks) { native::advanceMs(ticks); }
+void vTaskDelete(TaskHandle_t task) {}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out) {
+    *out = nullptr;
+    return 0;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t periodUs) { return 0; }
+int64_t esp_timer_get_time() { return (int64_t)nowUs; }
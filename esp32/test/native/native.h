@@ -0,0 +1,32 @@
+/**
+ * 原生构建测试辅助：假时钟与进程内 HTTP 请求
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace native {
+
+typedef std::vector<std::pair<std::string, std::string>> Args;
+
+// 假时钟：millis()/micros()/esp_timer_get_time() 只在这里推进
+void advanceUs(uint64_t us);
+inline void advanceMs(uint32_t ms) { advanceUs((uint64_t)ms * 1000); }
+
+// 时钟推进时的回调（FakeStm32 用来按时发送传感器流），返回编号供移除
+int onAdvance(std::function<void(unsigned long nowMs)> fn);
+void removeAdvance(int id);
+
+// 调用 setup() 中注册的路由处理函数；路由不存在时 code 为 404
+WebServer::Response request(WebServer& server, const char* uri, const Args& args = Args(),
+                            HTTPMethod method = HTTP_GET, const Args& headers = Args());
+
+// 创建过的任务（controlTask/netTask），测试可以确认 startTasks() 已执行
+size_t tasksCreated();
+
+}  // namespace native
@@ -0,0 +1,11 @@
+/**
+ * WebSocket 推送替身（env:native）
+ *
+ * telemetry_ws.cpp 依赖 ESPAsyncWebServer，原生构建不编译，这里提供空实现
+ */
+
+#include "telemetry_ws.h"
+
+void telemetryWsBegin() {}
+void telemetryWsLoop() {}
+int telemetryWsClientCount() { return 0; }
@@ -0,0 +1,25 @@
+/**
+ * 微基准基线（ns/op）
+ *
+ * 重新生成：SIMO_BENCH_UPDATE=1 pio test -e native -f test_bench，
+ * 把输出末尾的表格粘贴到这里。有意的性能变化（优化或新增功能）和基线一起提交。
+ *
+ * 当前数值：x86-64 Linux 构建机，g++ -O2（env:native）
+ */
+
+#pragma once
+
+struct BenchBaseline {
+    const char* name;
+    double nsPerOp;
+};
+
+static const BenchBaseline kBenchBaseline[] = {
+    {"parse_sensor_line", 71},
+    {"parse_sensor_text", 76},
+    {"encode_text_move", 6},
+    {"send_text_move", 418},
+    {"frame_encode_move", 61},
+    {"frame_decode_sensor", 91},
+    {"dispatch_sensor_line", 327},
+};
@@ -0,0 +1,192 @@
+/**
+ * 热路径微基准（pio test -e native -f test_bench）
+ *
+ * 在 Linux 构建机上测量每次操作的耗时（ns/op），与 bench_baseline.h 中保存的
+ * 基线比较，超过基线 × 容差时用例失败，刷机前发现吞吐量退化：
+ * - parse：STM32 传感器行解析（parseSensorLine，以及经 onStm32Sensor 写入全局状态）
+ * - encode：文本运动命令编码（encodeStm32Cmd，以及 sendToSTM32 + 应答匹配）、二进制 MOVE 帧编码
+ * - dispatch：串口字节 → 环形缓冲 → 组行/拆帧 → 按类型分发
+ *
+ * 环境变量：
+ *   SIMO_BENCH_TOLERANCE=<倍数>   默认 2.0（构建机之间的差异远小于真正的退化）
+ *   SIMO_BENCH_UPDATE=1           只输出新基线，不比较；结果粘贴到 bench_baseline.h
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "bench_baseline.h"
+#include "native.h"
+#include "sensor_parse.h"
+#include "stm32_cmd.h"
+#include "stm32_link.h"
+
+// ============ main.cpp 中的符号 ============
+void setup();
+void sendToSTM32(Stm32Cmd cmd, int speed, int arg);
+void onStm32Sensor(const char* line, size_t len);
+
+extern HardwareSerial stm32Serial;
+extern Stm32Link stm32Link;
+extern int lastDistance;
+
+#define BENCH_MIN_NS        200000000LL     // 每轮至少运行 200ms
+#define BENCH_ROUNDS        3               // 取最快一轮，减少调度噪声
+
+static const char kSensorLine[] = "SENSOR,D1234,OL1OR0,TL1TR1,T123456,V1";
+
+static double tolerance = 2.0;
+static bool updating = false;
+static std::vector<std::pair<const char*, double>> results;
+
+// 返回 ns/op：迭代次数翻倍直到单轮超过 BENCH_MIN_NS
+template <typename F>
+static double measure(F fn) {
+    double best = 0;
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        long long iters = 64;
+        while (true) {
+            auto start = std::chrono::steady_clock::now();
+            for (long long i = 0; i < iters; i++) fn();
+            long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            if (ns >= BENCH_MIN_NS) {
+                double perOp = (double)ns / iters;
+                if (round == 0 || perOp < best) best = perOp;
+                break;
+            }
+            iters *= 2;
+        }
+    }
+    return best;
+}
+
+static void check(const char* name, double nsPerOp) {
+    results.push_back({name, nsPerOp});
+    if (updating) {
+        printf("[BENCH] %-24s %10.1f ns/op  %10.0f 次/秒\n", name, nsPerOp, 1e9 / nsPerOp);
+        return;
+    }
+
+    const BenchBaseline* base = nullptr;
+    for (const BenchBaseline& b : kBenchBaseline) {
+        if (strcmp(b.name, name) == 0) base = &b;
+    }
+    if (!base) {
+        printf("[BENCH] %-24s %10.1f ns/op（没有基线）\n", name, nsPerOp);
+        return;
+    }
+
+    double ratio = nsPerOp / base->nsPerOp;
+    printf("[BENCH] %-24s %10.1f ns/op  %10.0f 次/秒  基线 %8.1f  %.2fx\n",
+           name, nsPerOp, 1e9 / nsPerOp, base->nsPerOp, ratio);
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%s 比基线慢 %.2f 倍（容差 %.2f）", name, ratio, tolerance);
+    TEST_ASSERT_TRUE_MESSAGE(ratio <= tolerance, msg);
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============ parse ============
+void test_bench_parse_sensor_line() {
+    SensorSnapshot s;
+    volatile bool ok = false;
+    check("parse_sensor_line", measure([&] {
+        ok = parseSensorLine(kSensorLine, sizeof(kSensorLine) - 1, &s);
+    }));
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_EQUAL(1234, s.distance);
+}
+
+void test_bench_parse_sensor_text() {
+    check("parse_sensor_text", measure([] {
+        onStm32Sensor(kSensorLine, sizeof(kSensorLine) - 1);
+    }));
+    TEST_ASSERT_EQUAL(1234, lastDistance);
+}
+
+// ============ encode ============
+void test_bench_encode_text_move() {
+    char buf[STM32_CMD_MAX_LEN];
+    volatile size_t n = 0;
+    int ms = 0;
+    check("encode_text_move", measure([&] {
+        n = encodeStm32Cmd<SimpleProtocol>(buf, CMD_FORWARD, 150, 500 + (ms++ & 0xFF));
+    }));
+    TEST_ASSERT_EQUAL_STRING("F,", std::string(buf, 2).c_str());
+}
+
+// 文本协议运动命令：格式化、入应答队列、写串口，再把应答喂回去完成匹配
+void test_bench_send_text_move() {
+    static const char ack[] = "OK,F,500\r\n";
+    check("send_text_move", measure([] {
+        sendToSTM32(CMD_FORWARD, 150, 500);
+        stm32Serial.inject((const uint8_t*)ack, sizeof(ack) - 1);
+        stm32Link.poll();
+    }));
+    TEST_ASSERT_EQUAL(0, stm32Link.pendingAcks());
+}
+
+void test_bench_frame_encode_move() {
+    static const uint8_t move[4] = {'F', 60, 0xF4, 0x01};
+    uint8_t out[FRAME_MAX_ENCODED];
+    volatile size_t n = 0;
+    uint8_t seq = 0;
+    check("frame_encode_move", measure([&] {
+        n = frameEncode(FRAME_MOVE, seq++, move, sizeof(move), out);
+    }));
+    TEST_ASSERT_EQUAL(10, n);
+}
+
+void test_bench_frame_decode_sensor() {
+    static const uint8_t payload[7] = {0xD2, 0x04, 0x05, 0x40, 0xE2, 0x01, 0x00};
+    uint8_t encoded[FRAME_MAX_ENCODED];
+    size_t len = frameEncode(FRAME_SENSOR, 0, payload, sizeof(payload), encoded) - 1;
+    Stm32Frame frame;
+    volatile bool ok = false;
+    check("frame_decode_sensor", measure([&] {
+        ok = frameDecode(encoded, len, &frame);
+    }));
+    TEST_ASSERT_TRUE(ok);
+}
+
+// ============ dispatch ============
+// 一行传感器数据从串口到解析完成的全过程（UART 回调 → 环形缓冲 → poll）
+void test_bench_dispatch_sensor_line() {
+    static const char line[] = "SENSOR,D1234,OL1OR0,TL1TR1,T123456,V1\r\n";
+    check("dispatch_sensor_line", measure([] {
+        stm32Serial.inject((const uint8_t*)line, sizeof(line) - 1);
+        stm32Link.poll();
+    }));
+    TEST_ASSERT_EQUAL(0, stm32Link.rxOverflows());
+}
+
+int main(int argc, char** argv) {
+    const char* tol = getenv("SIMO_BENCH_TOLERANCE");
+    const char* update = getenv("SIMO_BENCH_UPDATE");
+    if (tol) tolerance = atof(tol);
+    updating = update && update[0] == '1';
+
+    // 不接假 STM32：应答由用例直接注入，计时不包含对端的开销
+    setup();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_parse_sensor_line);
+    RUN_TEST(test_bench_parse_sensor_text);
+    RUN_TEST(test_bench_encode_text_move);
+    RUN_TEST(test_bench_send_text_move);
+    RUN_TEST(test_bench_frame_encode_move);
+    RUN_TEST(test_bench_frame_decode_sensor);
+    RUN_TEST(test_bench_dispatch_sensor_line);
+    int failures = UNITY_END();
+
+    if (updating) {
+        printf("\n// bench_baseline.h\n");
+        for (const auto& r : results) {
+            printf("    {\"%s\", %.0f},\n", r.first, r.second);
+        }
+    }
+    return failures;
+}
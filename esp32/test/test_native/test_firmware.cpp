@@ -0,0 +1,579 @@
+/**
+ * ESP32 固件主机测试（pio test -e native -f test_native）
+ *
+ * 编译 src/ 下的真实固件（main.cpp 等），串口对端换成进程内的假 STM32，
+ * 时间只随 native::advanceMs() 推进，每个用例都可以逐周期确定地复现。
+ *
+ * 用例按顺序模拟一次开机：先测纯函数和 HTTP 路由，再测文本协议下的命令编码和应答匹配，
+ * 之后心跳建立连接、协商二进制协议，最后是传感器流、巡逻避障、断线恢复和各种链路状态下的停车。
+ * 固件状态是全局的，调整顺序时注意前后依赖。
+ */
+
+#include <string>
+#include <unity.h>
+#include "control.h"
+#include "fake_stm32.h"
+#include "native.h"
+#include "sensor_parse.h"
+#include "stm32_cmd.h"
+#include "stm32_link.h"
+#include "web_pages.h"
+
+// ============ main.cpp 中的符号 ============
+void setup();
+void controlTick();
+void onStm32Sensor(const char* line, size_t len);
+void sendToSTM32(Stm32Cmd cmd, int speed, int arg);
+void sendTextToSTM32(const char* text);
+
+extern WebServer server;
+extern HardwareSerial stm32Serial;
+extern Stm32Link stm32Link;
+extern bool stm32Connected;
+extern unsigned long lastStm32Ping;
+extern int lastDistance;
+extern bool lastDistanceValid;
+extern bool leftIR, rightIR, leftTrack, rightTrack;
+extern uint32_t lastSensorStamp;
+extern uint32_t sensorSamples;
+extern RobotMode currentMode;
+
+// 在 main() 中创建（stm32Serial 是另一个编译单元的全局对象，不能在静态初始化时使用）
+static FakeStm32* stm32;
+
+// 按控制周期（10ms）推进
+static void runFor(unsigned long ms) {
+    for (unsigned long t = 0; t < ms; t += 10) {
+        native::advanceMs(10);
+        controlTick();
+    }
+}
+
+// 连接建立前的用例：推迟心跳，保持文本协议
+static void holdHeartbeat() {
+    lastStm32Ping = millis();
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_setup_starts_tasks() {
+    TEST_ASSERT_EQUAL(2, native::tasksCreated());
+    TEST_ASSERT_FALSE(stm32Connected);
+}
+
+// ============ 传感器解析 ============
+static bool parse(const char* line, SensorSnapshot* s) {
+    return parseSensorLine(line, strlen(line), s);
+}
+
+void test_parse_sensor_current_format() {
+    SensorSnapshot s;
+    TEST_ASSERT_TRUE(parse("SENSOR,D123,OL0OR1,TL1TR0,T45678,V1", &s));
+    TEST_ASSERT_EQUAL(123, s.distance);
+    TEST_ASSERT_FALSE(s.leftIR);
+    TEST_ASSERT_TRUE(s.rightIR);
+    TEST_ASSERT_TRUE(s.leftTrack);
+    TEST_ASSERT_FALSE(s.rightTrack);
+    TEST_ASSERT_EQUAL(45678, s.sampleMs);
+    TEST_ASSERT_TRUE(s.distanceValid);
+    TEST_ASSERT_EQUAL(SENSOR_HAS_DIST | SENSOR_HAS_OBS | SENSOR_HAS_TRACK | SENSOR_HAS_STAMP |
+                      SENSOR_HAS_VALID, s.fields);
+
+    TEST_ASSERT_TRUE(parse("SENSOR,D80,OL1OR1,TL0TR0,T100,V0", &s));
+    TEST_ASSERT_FALSE(s.distanceValid);
+}
+
+void test_parse_sensor_legacy_format() {
+    SensorSnapshot s;
+    TEST_ASSERT_TRUE(parse("SENSOR,D456,L0R1", &s));
+    TEST_ASSERT_EQUAL(456, s.distance);
+    TEST_ASSERT_FALSE(s.leftIR);
+    TEST_ASSERT_TRUE(s.rightIR);
+    TEST_ASSERT_EQUAL(0, s.sampleMs);
+    TEST_ASSERT_TRUE(s.distanceValid);
+    TEST_ASSERT_EQUAL(SENSOR_HAS_DIST | SENSOR_HAS_OBS, s.fields);
+
+    // simo_minimal：没有时间戳和可信标志
+    TEST_ASSERT_TRUE(parse("SENSOR,D-1,OL1OR1,TL1TR1", &s));
+    TEST_ASSERT_EQUAL(-1, s.distance);
+    TEST_ASSERT_EQUAL(0, s.fields & (SENSOR_HAS_STAMP | SENSOR_HAS_VALID));
+
+    // 未知字段跳过
+    TEST_ASSERT_TRUE(parse("SENSOR,D10,OL1OR1,X42", &s));
+    TEST_ASSERT_EQUAL(10, s.distance);
+}
+
+void test_parse_sensor_rejects_malformed() {
+    static const char* const bad[] = {
+        "", "SENSOR", "SENSORD12", "SENS", "DIST,12", "SENSOR,OL1OR1",
+        "SENSOR,D", "SENSOR,D12x", "SENSOR,D99999", "SENSOR,D12,,OL1OR1",
+        "SENSOR,D12,OL2OR1", "SENSOR,D12,OL1", "SENSOR,D12,OL1OR1,TL1TR", "SENSOR,D12,L1",
+        "SENSOR,D12,T", "SENSOR,D12,T4294967296", "SENSOR,D12,V", "SENSOR,D12,V10",
+        "SENSOR,D12,", "SENSOR,D12,ol1or1",
+    };
+    SensorSnapshot s = {};
+    s.distance = 7;
+    for (const char* line : bad) {
+        TEST_ASSERT_FALSE_MESSAGE(parse(line, &s), line);
+    }
+    TEST_ASSERT_EQUAL(7, s.distance);
+}
+
+// 经 Stm32Link 回调写入全局状态；旧格式不带的字段保持原值
+void test_sensor_line_updates_state() {
+    const char* line = "SENSOR,D321,OL1OR0,TL0TR1,T999,V1";
+    uint32_t samples = sensorSamples;
+    onStm32Sensor(line, strlen(line));
+    TEST_ASSERT_EQUAL(321, lastDistance);
+    TEST_ASSERT_TRUE(leftIR);
+    TEST_ASSERT_FALSE(rightIR);
+    TEST_ASSERT_TRUE(rightTrack);
+    TEST_ASSERT_EQUAL(999, lastSensorStamp);
+    TEST_ASSERT_EQUAL(samples + 1, sensorSamples);
+
+    line = "SENSOR,D50,L0R1";
+    onStm32Sensor(line, strlen(line));
+    TEST_ASSERT_EQUAL(50, lastDistance);
+    TEST_ASSERT_TRUE(rightIR);
+    TEST_ASSERT_TRUE(rightTrack);
+    TEST_ASSERT_EQUAL(0, lastSensorStamp);
+
+    line = "SENSOR,D5x";
+    onStm32Sensor(line, strlen(line));
+    TEST_ASSERT_EQUAL(50, lastDistance);
+    TEST_ASSERT_EQUAL(samples + 2, sensorSamples);
+}
+
+// ============ HTTP 路由 ============
+void test_http_ping() {
+    WebServer::Response r = native::request(server, "/ping");
+    TEST_ASSERT_EQUAL(200, r.code);
+    TEST_ASSERT_EQUAL_STRING("PONG", r.body.c_str());
+}
+
+void test_http_mode_switch() {
+    holdHeartbeat();
+    WebServer::Response r = native::request(server, "/mode", {{"m", "manual"}});
+    TEST_ASSERT_EQUAL(200, r.code);
+    controlTick();
+    TEST_ASSERT_EQUAL(MODE_MANUAL, currentMode);
+
+    r = native::request(server, "/mode", {{"m", "fly"}});
+    TEST_ASSERT_TRUE(r.body.find("无效模式") != std::string::npos);
+    controlTick();
+    TEST_ASSERT_EQUAL(MODE_MANUAL, currentMode);
+
+    native::request(server, "/mode", {{"m", "idle"}});
+    controlTick();
+    TEST_ASSERT_EQUAL(MODE_IDLE, currentMode);
+}
+
+void test_http_status_json() {
+    WebServer::Response r = native::request(server, "/status");
+    TEST_ASSERT_EQUAL(200, r.code);
+    TEST_ASSERT_EQUAL_STRING("application/json", r.type.c_str());
+    TEST_ASSERT_TRUE(r.body.find("\"mode\":\"idle\"") != std::string::npos);
+    TEST_ASSERT_TRUE(r.body.find("\"version\":") != std::string::npos);
+}
+
+// 预压缩页面：gzip 原样发送，ETag 命中时 304 不带正文
+void test_http_page_gzip_etag() {
+    WebServer::Response r = native::request(server, "/");
+    TEST_ASSERT_EQUAL(200, r.code);
+    TEST_ASSERT_EQUAL_STRING("gzip", r.header("Content-Encoding").c_str());
+    TEST_ASSERT_EQUAL(WEB_INDEX.len, r.body.size());
+    TEST_ASSERT_EQUAL(0x1f, (uint8_t)r.body[0]);
+    TEST_ASSERT_EQUAL(0x8b, (uint8_t)r.body[1]);
+    std::string etag = r.header("ETag");
+    TEST_ASSERT_EQUAL_STRING(WEB_INDEX.etag, etag.c_str());
+
+    r = native::request(server, "/", {}, HTTP_GET, {{"If-None-Match", etag}});
+    TEST_ASSERT_EQUAL(304, r.code);
+    TEST_ASSERT_TRUE(r.body.empty());
+    TEST_ASSERT_TRUE(r.header("Content-Encoding").empty());
+
+    // 其他页面的 ETag 不通用
+    r = native::request(server, "/wifi", {}, HTTP_GET, {{"If-None-Match", etag}});
+    TEST_ASSERT_EQUAL(200, r.code);
+    TEST_ASSERT_EQUAL(WEB_WIFI.len, r.body.size());
+}
+
+void test_http_unknown_route() {
+    WebServer::Response r = native::request(server, "/nope");
+    TEST_ASSERT_EQUAL(404, r.code);
+}
+
+// ============ 文本协议 ============
+void test_motion_protocol_encoders() {
+    char buf[STM32_CMD_MAX_LEN];
+
+    TEST_ASSERT_EQUAL(6, encodeStm32Cmd<SimpleProtocol>(buf, CMD_FORWARD, 60, 500));
+    TEST_ASSERT_EQUAL_STRING("F,500\n", buf);
+    encodeStm32Cmd<SimpleProtocol>(buf, CMD_RIGHT, 150, 70000);     // 持续时间按 uint16 限幅
+    TEST_ASSERT_EQUAL_STRING("R,65535\n", buf);
+    encodeStm32Cmd<SimpleProtocol>(buf, CMD_BACKWARD, 0, -5);
+    TEST_ASSERT_EQUAL_STRING("B,0\n", buf);
+
+    encodeStm32Cmd<MotionV1Protocol>(buf, CMD_FORWARD, 50, 1000);
+    TEST_ASSERT_EQUAL_STRING("M,forward,0.50,1000\n", buf);
+    encodeStm32Cmd<MotionV1Protocol>(buf, CMD_LEFT, 7, 300);
+    TEST_ASSERT_EQUAL_STRING("M,left,0.07,300\n", buf);
+    encodeStm32Cmd<MotionV1Protocol>(buf, CMD_BACKWARD, 150, 65535);  // 速度超过 100 按 1.00
+    TEST_ASSERT_EQUAL_STRING("M,backward,1.00,65535\n", buf);
+
+    // 非运动命令两种协议相同
+    encodeStm32Cmd<MotionV1Protocol>(buf, CMD_STOP, 0, 0);
+    TEST_ASSERT_EQUAL_STRING("S\n", buf);
+    encodeStm32Cmd<SimpleProtocol>(buf, CMD_PING, 0, 0);
+    TEST_ASSERT_EQUAL_STRING("PING\n", buf);
+    encodeStm32Cmd<SimpleProtocol>(buf, CMD_SENSOR, 0, 0);
+    TEST_ASSERT_EQUAL_STRING("SENSOR\n", buf);
+    encodeStm32Cmd<MotionV1Protocol>(buf, CMD_STREAM, 0, 20);
+    TEST_ASSERT_EQUAL_STRING("STREAM,20\n", buf);
+    encodeStm32Cmd<SimpleProtocol>(buf, CMD_VELOCITY, 60, -40);
+    TEST_ASSERT_EQUAL_STRING("V,60,-40\n", buf);
+    encodeStm32Cmd<SimpleProtocol>(buf, CMD_VELOCITY, 150, -300);    // 设定值按 ±100 限幅
+    TEST_ASSERT_EQUAL_STRING("V,100,-100\n", buf);
+
+    Stm32Cmd cmd;
+    TEST_ASSERT_TRUE(stm32CmdFromName("L", 1, &cmd));
+    TEST_ASSERT_EQUAL(CMD_LEFT, cmd);
+    TEST_ASSERT_TRUE(stm32CmdFromName("SENSOR", 6, &cmd));
+    TEST_ASSERT_EQUAL(CMD_SENSOR, cmd);
+    TEST_ASSERT_FALSE(stm32CmdFromName("X", 1, &cmd));
+    TEST_ASSERT_FALSE(stm32CmdFromName("STREAM", 6, &cmd));
+
+    int8_t left = 0, right = 0;
+    TEST_ASSERT_TRUE(stm32ParseVelocity("-100,35", &left, &right));
+    TEST_ASSERT_EQUAL(-100, left);
+    TEST_ASSERT_EQUAL(35, right);
+    TEST_ASSERT_FALSE(stm32ParseVelocity("101,0", &left, &right));
+    TEST_ASSERT_FALSE(stm32ParseVelocity("10", &left, &right));
+    TEST_ASSERT_FALSE(stm32ParseVelocity("10,", &left, &right));
+    TEST_ASSERT_FALSE(stm32ParseVelocity("10,5x", &left, &right));
+
+    TEST_ASSERT_TRUE(stm32TextCmdValid("BEEP", 7));
+    TEST_ASSERT_FALSE(stm32TextCmdValid("", 7));
+    TEST_ASSERT_FALSE(stm32TextCmdValid("S\nF,9", 7));
+    TEST_ASSERT_FALSE(stm32TextCmdValid("TOOLONG!", 7));
+}
+
+void test_text_motion_encoding() {
+    holdHeartbeat();
+    TEST_ASSERT_FALSE(stm32Link.binary());
+    stm32->commands.clear();
+
+    // 语音命令 → 控制队列 → simple 协议 "F,<ms>"
+    native::request(server, "/voice", {{"text", "前进"}});
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("F,1000", stm32->last("F").c_str());
+    TEST_ASSERT_EQUAL(MODE_MANUAL, currentMode);
+
+    native::request(server, "/cmd", {{"c", "L"}, {"duration", "300"}});
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("L,300", stm32->last("L").c_str());
+
+    // 透传命令先校验：含换行的直接拒绝，超长的整条拒绝（不截断），都不会发到串口
+    size_t sent = stm32->commands.size();
+    TEST_ASSERT_EQUAL_STRING("ERR,cmd", native::request(server, "/cmd", {{"c", "S\nF,9"}}).body.c_str());
+    TEST_ASSERT_EQUAL_STRING("ERR,length",
+        native::request(server, "/cmd", {{"c", "SEQ,F1000,L400,F1000,R400,F1000"}}).body.c_str());
+    controlTick();
+    TEST_ASSERT_EQUAL(sent, stm32->commands.size());
+
+    // 应答在下一个周期匹配
+    controlTick();
+    TEST_ASSERT_EQUAL(0, stm32Link.pendingAcks());
+    TEST_ASSERT_EQUAL_STRING("OK,L,300", stm32Link.lastAck());
+
+    // 长调试命令（SEQ、LINECFG 等）原样透传
+    TEST_ASSERT_EQUAL_STRING("OK", native::request(server, "/cmd", {{"c", "SEQ,B300,L400@60,F1000"}}).body.c_str());
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("SEQ,B300,L400@60,F1000", stm32->last().c_str());
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("OK,SEQ", stm32Link.lastAck());
+
+    // 查询命令的回复不是 OK/ERR，不进入应答队列
+    native::request(server, "/cmd", {{"c", "ODOM"}});
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("ODOM", stm32->last().c_str());
+    controlTick();
+    TEST_ASSERT_EQUAL(0, stm32Link.pendingAcks());
+    native::request(server, "/cmd", {{"c", "GOV"}});
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("GOV", stm32->last().c_str());
+    controlTick();
+    TEST_ASSERT_EQUAL(0, stm32Link.pendingAcks());
+
+    native::request(server, "/mode", {{"m", "idle"}});
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("S", stm32->commands.back().c_str());
+}
+
+// ============ 应答匹配 ============
+void test_ack_matching() {
+    static const char stray[] = "OK,F,500\r\n";
+    holdHeartbeat();
+    uint32_t timeouts = stm32Link.ackTimeouts();
+    uint32_t late = stm32Link.lateAcks();
+
+    // simo_robot_simple 执行完运动才回复：应答超时从执行完算起，排在后面的命令顺延
+    stm32->blockingMoves = true;
+    sendToSTM32(CMD_FORWARD, 0, 300);
+    sendTextToSTM32("BEEP");
+    runFor(250);
+    TEST_ASSERT_EQUAL(2, stm32Link.pendingAcks());
+    runFor(100);
+    TEST_ASSERT_EQUAL(0, stm32Link.pendingAcks());
+    TEST_ASSERT_EQUAL_STRING("OK,BEEP", stm32Link.lastAck());
+    TEST_ASSERT_EQUAL(timeouts, stm32Link.ackTimeouts());
+    stm32->blockingMoves = false;
+
+    // 已超时命令的迟到应答不算到后面的命令头上
+    stm32Serial.inject((const uint8_t*)stray, sizeof(stray) - 1);
+    sendTextToSTM32("BEEP");
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("OK,BEEP", stm32Link.lastAck());
+    TEST_ASSERT_EQUAL(late + 1, stm32Link.lateAcks());
+    TEST_ASSERT_EQUAL(timeouts, stm32Link.ackTimeouts());
+
+    // 也不会被当成 BIN 协商的结果
+    stm32Serial.inject((const uint8_t*)stray, sizeof(stray) - 1);
+    stm32Link.requestBinary();
+    controlTick();
+    TEST_ASSERT_TRUE(stm32Link.binary());
+    TEST_ASSERT_FALSE(stm32Link.binaryUnsupported());
+    TEST_ASSERT_EQUAL(late + 2, stm32Link.lateAcks());
+
+    // 回到文本协议，协商留给心跳用例
+    stm32->silent = true;
+    stm32Link.revertToText();
+    stm32->silent = false;
+    stm32->reset();
+    stm32->commands.clear();
+}
+
+static std::string rxLines;
+
+static void collectLine(const char* line, size_t len) {
+    rxLines.append(line, len);
+    rxLines += '|';
+}
+
+// 接收缓冲满时丢弃的是正在组装的那一行，前面完整的行照常处理
+void test_rx_overflow_discards_damaged_line() {
+    HardwareSerial port(2);
+    Stm32Link link;
+    link.begin(port);
+    link.onUnsolicited(collectLine);
+    rxLines.clear();
+
+    std::string burst, expected;
+    for (int i = 0; i < 160; i++) {
+        burst += "X123\r\n";
+        expected += "X123|";
+    }
+    burst += "B," + std::string(80, '0');               // 环形缓冲在这一行中间写满
+    port.inject((const uint8_t*)burst.data(), burst.size());
+    TEST_ASSERT_TRUE(link.rxOverflows() > 0);
+    link.poll();
+
+    static const char rest[] = "abcdef\r\nC\r\n";
+    port.inject((const uint8_t*)rest, sizeof(rest) - 1);
+    link.poll();
+    TEST_ASSERT_EQUAL_STRING((expected + "C|").c_str(), rxLines.c_str());
+}
+
+// ============ 连接与二进制协议 ============
+void test_heartbeat_connects_and_negotiates_binary() {
+    runFor(5100);
+    TEST_ASSERT_TRUE(stm32Connected);
+    TEST_ASSERT_EQUAL(1, stm32->count("BIN"));
+    TEST_ASSERT_TRUE(stm32->binary());
+    TEST_ASSERT_TRUE(stm32Link.binary());
+
+    // /metrics 从控制任务发布的快照读取连接状态
+    WebServer::Response r = native::request(server, "/metrics");
+    TEST_ASSERT_TRUE(r.body.find("simo_stm32_connected 1\n") != std::string::npos);
+}
+
+void test_binary_motion_encoding() {
+    stm32->commands.clear();
+    sendToSTM32(CMD_FORWARD, 60, 500);
+    TEST_ASSERT_EQUAL_STRING("F,500", stm32->last().c_str());
+    TEST_ASSERT_EQUAL(60, stm32->lastPwm);
+
+    // 没有紧凑编码的命令装进 TEXT 帧
+    native::request(server, "/cmd", {{"c", "BEEP"}});
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("BEEP", stm32->last().c_str());
+
+    // MOVE 的 ACK 帧按序号匹配，TEXT 帧的文本回复按顺序匹配
+    uint32_t timeouts = stm32Link.ackTimeouts();
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("OK,BEEP", stm32Link.lastAck());
+    TEST_ASSERT_EQUAL(timeouts, stm32Link.ackTimeouts());
+    TEST_ASSERT_EQUAL(0, stm32Link.frameErrors());
+
+    // 找不到对应命令的 ACK 帧只计数，不覆盖最近一次应答
+    static const uint8_t ack[] = {1, FRAME_MOVE};
+    uint8_t out[FRAME_MAX_ENCODED];
+    uint32_t late = stm32Link.lateAcks();
+    stm32Serial.inject(out, frameEncode(FRAME_ACK, 0xEE, ack, sizeof(ack), out));
+    controlTick();
+    TEST_ASSERT_EQUAL(late + 1, stm32Link.lateAcks());
+    TEST_ASSERT_EQUAL_STRING("OK,BEEP", stm32Link.lastAck());
+}
+
+// ============ 速度模式 ============
+void test_velocity_setpoints() {
+    stm32->commands.clear();
+    TEST_ASSERT_EQUAL(MODE_IDLE, currentMode);
+
+    // 摇杆接管：切到手动，二进制模式下发 VEL 帧
+    TEST_ASSERT_EQUAL_STRING("OK", native::request(server, "/vel", {{"l", "60"}, {"r", "-40"}}).body.c_str());
+    controlTick();
+    TEST_ASSERT_EQUAL(MODE_MANUAL, currentMode);
+    TEST_ASSERT_EQUAL_STRING("V,60,-40", stm32->last().c_str());
+
+    // 一个控制周期内到达的多个设定值只发最新一条
+    native::request(server, "/vel", {{"l", "10"}, {"r", "10"}});
+    native::request(server, "/vel", {{"l", "20"}, {"r", "20"}});
+    native::request(server, "/vel", {{"l", "30"}, {"r", "25"}});
+    controlTick();
+    TEST_ASSERT_EQUAL(2, stm32->count("V,"));
+    TEST_ASSERT_EQUAL_STRING("V,30,25", stm32->last().c_str());
+
+    // 超出范围不发送
+    TEST_ASSERT_EQUAL(400, native::request(server, "/vel", {{"l", "150"}, {"r", "0"}}).code);
+    TEST_ASSERT_EQUAL(400, native::request(server, "/vel", {{"l", "20"}}).code);
+    controlTick();
+    TEST_ASSERT_EQUAL(2, stm32->count("V,"));
+    TEST_ASSERT_EQUAL(0, stm32Link.frameErrors());
+
+    native::request(server, "/mode", {{"m", "idle"}});
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("S", stm32->last().c_str());
+}
+
+void test_sensor_stream() {
+    runFor(1000);
+    TEST_ASSERT_EQUAL(20, stm32->streamHz());
+
+    stm32->distance = 777;
+    stm32->obsLeft = true;
+    uint32_t before = sensorSamples;
+    runFor(200);
+    TEST_ASSERT_GREATER_OR_EQUAL(before + 3, sensorSamples);
+    TEST_ASSERT_EQUAL(777, lastDistance);
+    TEST_ASSERT_FALSE(leftIR);      // 低电平有效
+    TEST_ASSERT_TRUE(rightIR);
+
+    stm32->obsLeft = false;
+    runFor(100);
+}
+
+// ============ 巡逻避障 ============
+void test_patrol_turns_away_from_obstacle() {
+    stm32->distance = 2000;
+    native::request(server, "/mode", {{"m", "patrol"}});
+    runFor(200);
+    TEST_ASSERT_EQUAL(MODE_PATROL, currentMode);
+    TEST_ASSERT_EQUAL_STRING("F,400", stm32->last("F").c_str());
+    TEST_ASSERT_EQUAL(100, stm32->lastPwm);
+
+    // 右侧红外挡住 → 下一个传感器样本就左转
+    stm32->commands.clear();
+    stm32->distance = 300;
+    stm32->obsRight = true;
+    runFor(60);
+    TEST_ASSERT_EQUAL(1, stm32->count("L,"));
+    TEST_ASSERT_EQUAL(0, stm32->count("R,"));
+
+    // 太近：后退
+    stm32->commands.clear();
+    stm32->obsRight = false;
+    stm32->distance = 100;
+    runFor(400);
+    TEST_ASSERT_GREATER_OR_EQUAL(1, stm32->count("B,"));
+
+    stm32->distance = 2000;
+    native::request(server, "/mode", {{"m", "idle"}});
+    controlTick();
+    TEST_ASSERT_EQUAL_STRING("S", stm32->commands.back().c_str());
+}
+
+// ============ 断线 ============
+void test_link_loss_falls_back_to_text() {
+    stm32->silent = true;
+    runFor(5300);
+    TEST_ASSERT_FALSE(stm32Connected);
+    TEST_ASSERT_FALSE(stm32Link.binary());
+
+    // STM32 复位后回到文本模式，下一次心跳重新连接并协商
+    stm32->reset();
+    stm32->silent = false;
+    runFor(5100);
+    TEST_ASSERT_TRUE(stm32Connected);
+    TEST_ASSERT_TRUE(stm32Link.binary());
+}
+
+// ============ 停车 ============
+void test_stop_bypasses_negotiation_and_full_queue() {
+    // 应答队列已满：STOP 帧照样发出
+    stm32->commands.clear();
+    for (int i = 0; i < STM32_PENDING_MAX; i++) sendTextToSTM32("BEEP");
+    TEST_ASSERT_EQUAL(STM32_PENDING_MAX, stm32Link.pendingAcks());
+    sendToSTM32(CMD_STOP, 0, 0);
+    TEST_ASSERT_EQUAL_STRING("S", stm32->last().c_str());
+    controlTick();
+    TEST_ASSERT_EQUAL(0, stm32Link.pendingAcks());
+
+    // 断线回到文本协议，再次协商期间停车：先记下，OK,BIN 一到就按二进制发出
+    stm32->silent = true;
+    runFor(5300);
+    TEST_ASSERT_FALSE(stm32Link.binary());
+    stm32->reset();
+    stm32->silent = false;
+    holdHeartbeat();
+    stm32->commands.clear();
+    stm32Link.requestBinary();
+    sendToSTM32(CMD_STOP, 0, 0);
+    TEST_ASSERT_EQUAL_STRING("BIN", stm32->last().c_str());
+    controlTick();
+    TEST_ASSERT_TRUE(stm32Link.binary());
+    TEST_ASSERT_EQUAL_STRING("S", stm32->last().c_str());
+    TEST_ASSERT_EQUAL(2, stm32->commands.size());
+    TEST_ASSERT_EQUAL(0, stm32Link.frameErrors());
+}
+
+int main(int argc, char** argv) {
+    FakeStm32 fake(stm32Serial);
+    stm32 = &fake;
+    setup();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_setup_starts_tasks);
+    RUN_TEST(test_parse_sensor_current_format);
+    RUN_TEST(test_parse_sensor_legacy_format);
+    RUN_TEST(test_parse_sensor_rejects_malformed);
+    RUN_TEST(test_sensor_line_updates_state);
+    RUN_TEST(test_http_ping);
+    RUN_TEST(test_http_mode_switch);
+    RUN_TEST(test_http_status_json);
+    RUN_TEST(test_http_page_gzip_etag);
+    RUN_TEST(test_http_unknown_route);
+    RUN_TEST(test_motion_protocol_encoders);
+    RUN_TEST(test_text_motion_encoding);
+    RUN_TEST(test_ack_matching);
+    RUN_TEST(test_rx_overflow_discards_damaged_line);
+    RUN_TEST(test_heartbeat_connects_and_negotiates_binary);
+    RUN_TEST(test_binary_motion_encoding);
+    RUN_TEST(test_velocity_setpoints);
+    RUN_TEST(test_sensor_stream);
+    RUN_TEST(test_patrol_turns_away_from_obstacle);
+    RUN_TEST(test_link_loss_falls_back_to_text);
+    RUN_TEST(test_stop_bypasses_negotiation_and_full_queue);
+    return UNITY_END();
+}
@@ -113,10 +113,13 @@ export async function readInfrared() {
 export function handleSensorResponse(data) {
   const now = Date.now();
   
-  // DIST,123 -> 距离 12.3cm
+  // 带 V0 的距离 STM32 判定为不可信（滤波后一致样本不足），保留上一次的值
+  const distanceValid = !/,V0(,|$)/.test(data);
+  
+  // DIST,123[,V1,T<ms>] -> 距离 12.3cm
   if (data.startsWith('DIST,')) {
     const value = parseInt(data.substring(5));
-    if (!isNaN(value)) {
+    if (!isNaN(value) && distanceValid) {
       sensorData.ultrasonic.distance = value / 10;  // 转换为 cm
       sensorData.ultrasonic.lastUpdate = now;
     }
@@ -138,7 +141,7 @@ export function handleSensorResponse(data) {
     for (const part of parts) {
       if (part.startsWith('D')) {
         const value = parseInt(part.substring(1));
-        if (!isNaN(value)) {
+        if (!isNaN(value) && distanceValid) {
           sensorData.ultrasonic.distance = value / 10;
           sensorData.ultrasonic.lastUpdate = now;
         }
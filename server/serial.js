@@ -163,6 +163,8 @@ function handleResponse(data) {
   }
   
   const now = Date.now()
+  // 带 V0 的距离 STM32 判定为不可信，保留上一次的值
+  const distanceValid = !/,V0(,|$)/.test(response)
   
   // 解析响应
   if (response === 'PONG') {
@@ -175,7 +177,7 @@ function handleResponse(data) {
   // 传感器响应解析
   else if (response.startsWith('DIST,')) {
     const value = parseInt(response.substring(5))
-    if (!isNaN(value)) {
+    if (!isNaN(value) && distanceValid) {
       sensorCache.ultrasonic.distance = value / 10  // 0.1cm -> cm
       sensorCache.ultrasonic.lastUpdate = now
     }
@@ -194,7 +196,7 @@ function handleResponse(data) {
     for (const part of parts) {
       if (part.startsWith('D')) {
         const value = parseInt(part.substring(1))
-        if (!isNaN(value)) {
+        if (!isNaN(value) && distanceValid) {
           sensorCache.ultrasonic.distance = value / 10
           sensorCache.ultrasonic.lastUpdate = now
         }
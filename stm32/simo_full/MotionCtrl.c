@@ -0,0 +1,132 @@
+/**
+ * 轮速闭环与里程计实现，见 MotionCtrl.h
+ */
+
+#include <math.h>
+#include "MotionCtrl.h"
+
+// 默认参数（mm/s → PWM%），用 sim/ 中的模型整定
+#define PID_KP          0.30f
+#define PID_KI          5.0f
+#define PID_KD          0.0f
+#define PID_KFF         0.18f     // 满电时 300mm/s 约需 60%，余量交给积分
+#define PID_OUT_LIMIT   100.0f
+#define SPEED_FILTER    0.5f      // 实测速度低通系数（0~1，越大越跟手）
+
+#define PI_F            3.14159265f
+
+// ============ PID ============
+void Pid_Init(Pid *pid, float kp, float ki, float kd, float kff, float outLimit)
+{
+    pid->kp = kp;
+    pid->ki = ki;
+    pid->kd = kd;
+    pid->kff = kff;
+    pid->outLimit = outLimit;
+    Pid_Reset(pid);
+}
+
+void Pid_Reset(Pid *pid)
+{
+    pid->integral = 0;
+    pid->prevMeasured = 0;
+}
+
+float Pid_Update(Pid *pid, float setpoint, float measured, float dt)
+{
+    float err = setpoint - measured;
+    float ff = pid->kff * setpoint;
+    float deriv = dt > 0 ? -(measured - pid->prevMeasured) / dt : 0;
+    float integral = pid->integral + pid->ki * err * dt;
+    float out;
+
+    pid->prevMeasured = measured;
+
+    // 积分抗饱和：输出已经饱和且误差继续推向饱和方向时不再累积
+    out = ff + pid->kp * err + integral + pid->kd * deriv;
+    if ((out > pid->outLimit && err > 0) || (out < -pid->outLimit && err < 0)) {
+        out = ff + pid->kp * err + pid->integral + pid->kd * deriv;
+    } else {
+        pid->integral = integral;
+    }
+
+    if (out > pid->outLimit) out = pid->outLimit;
+    if (out < -pid->outLimit) out = -pid->outLimit;
+    return out;
+}
+
+// ============ 里程计 ============
+void Odom_Init(Odometry *odom, float mmPerTick, float wheelBase)
+{
+    odom->mmPerTick = mmPerTick;
+    odom->wheelBase = wheelBase;
+    Odom_Reset(odom);
+}
+
+void Odom_Reset(Odometry *odom)
+{
+    odom->x = 0;
+    odom->y = 0;
+    odom->heading = 0;
+}
+
+// 差速模型，按本周期中点航向积分（二阶精度）
+void Odom_Update(Odometry *odom, int32_t ticksLeft, int32_t ticksRight)
+{
+    float dl = ticksLeft * odom->mmPerTick;
+    float dr = ticksRight * odom->mmPerTick;
+    float ds = (dl + dr) * 0.5f;
+    float dth = (dr - dl) / odom->wheelBase;
+    float mid = odom->heading + dth * 0.5f;
+
+    odom->x += ds * cosf(mid);
+    odom->y += ds * sinf(mid);
+    odom->heading += dth;
+    if (odom->heading > PI_F) odom->heading -= 2 * PI_F;
+    else if (odom->heading <= -PI_F) odom->heading += 2 * PI_F;
+}
+
+// ============ 两轮速度控制 ============
+void MotionCtrl_Init(MotionCtrl *mc, float mmPerTick, float wheelBase)
+{
+    Pid_Init(&mc->left, PID_KP, PID_KI, PID_KD, PID_KFF, PID_OUT_LIMIT);
+    Pid_Init(&mc->right, PID_KP, PID_KI, PID_KD, PID_KFF, PID_OUT_LIMIT);
+    Odom_Init(&mc->odom, mmPerTick, wheelBase);
+    MotionCtrl_Reset(mc);
+}
+
+// 清零目标和 PID 状态（急停用），不清里程计
+void MotionCtrl_Reset(MotionCtrl *mc)
+{
+    Pid_Reset(&mc->left);
+    Pid_Reset(&mc->right);
+    mc->targetLeft = mc->targetRight = 0;
+    mc->speedLeft = mc->speedRight = 0;
+}
+
+void MotionCtrl_Step(MotionCtrl *mc, int32_t ticksLeft, int32_t ticksRight, float dt,
+                     float *pwmLeft, float *pwmRight)
+{
+    float vl = ticksLeft * mc->odom.mmPerTick / dt;
+    float vr = ticksRight * mc->odom.mmPerTick / dt;
+
+    Odom_Update(&mc->odom, ticksLeft, ticksRight);
+
+    // 编码器分辨率有限，低速时单周期增量跳动大
+    mc->speedLeft += SPEED_FILTER * (vl - mc->speedLeft);
+    mc->speedRight += SPEED_FILTER * (vr - mc->speedRight);
+
+    // 目标为 0 时直接停，不让积分项维持残余 PWM
+    if (mc->targetLeft == 0) {
+        Pid_Reset(&mc->left);
+        *pwmLeft = 0;
+    } else {
+        *pwmLeft = Pid_Update(&mc->left, mc->targetLeft, mc->speedLeft, dt);
+    }
+    if (mc->targetRight == 0) {
+        Pid_Reset(&mc->right);
+        *pwmRight = 0;
+    } else {
+        *pwmRight = Pid_Update(&mc->right, mc->targetRight, mc->speedRight, dt);
+    }
+}
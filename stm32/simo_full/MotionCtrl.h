@@ -0,0 +1,55 @@
+/**
+ * 轮速闭环与里程计 - 与硬件无关，固件和主机仿真（sim/）共用
+ *
+ * 每个控制周期输入两轮编码器增量，输出两轮 PWM（-100~100）：
+ *   PWM = 前馈 × 目标速度 + PID(目标速度 - 实测速度)
+ * 同时按差速模型积分出位姿 x/y/航向。
+ *
+ * 坐标系：上电（或 Odom_Reset）时车头朝 +x，逆时针为正航向。
+ */
+
+#ifndef __MOTIONCTRL_H
+#define __MOTIONCTRL_H
+
+#include <stdint.h>
+
+// ============ PID ============
+typedef struct {
+    float kp, ki, kd;
+    float kff;              // 前馈：每 mm/s 对应的 PWM
+    float outLimit;         // 输出限幅（PWM %）
+    float integral;
+    float prevMeasured;     // 微分作用在实测值上，目标突变不产生冲击
+} Pid;
+
+void Pid_Init(Pid *pid, float kp, float ki, float kd, float kff, float outLimit);
+void Pid_Reset(Pid *pid);
+float Pid_Update(Pid *pid, float setpoint, float measured, float dt);
+
+// ============ 里程计 ============
+typedef struct {
+    float x, y;             // mm
+    float heading;          // rad，(-π, π]
+    float mmPerTick;
+    float wheelBase;        // 两轮中心距 mm
+} Odometry;
+
+void Odom_Init(Odometry *odom, float mmPerTick, float wheelBase);
+void Odom_Reset(Odometry *odom);
+void Odom_Update(Odometry *odom, int32_t ticksLeft, int32_t ticksRight);
+
+// ============ 两轮速度控制 ============
+typedef struct {
+    Pid left, right;
+    Odometry odom;
+    float targetLeft, targetRight;  // mm/s
+    float speedLeft, speedRight;    // 实测 mm/s（一阶低通）
+} MotionCtrl;
+
+void MotionCtrl_Init(MotionCtrl *mc, float mmPerTick, float wheelBase);
+void MotionCtrl_Reset(MotionCtrl *mc);
+// 一个控制周期：ticks 为本周期编码器增量，dt 为周期（s）；输出 PWM（-100~100）
+void MotionCtrl_Step(MotionCtrl *mc, int32_t ticksLeft, int32_t ticksRight, float dt,
+                     float *pwmLeft, float *pwmRight);
+
+#endif
@@ -0,0 +1,154 @@
+/**
+ * 串口接收实现，见 SerialRx.h
+ */
+
+#include <string.h>
+#include "SerialRx.h"
+
+// ============ 帧校验 / 解码 ============
+uint16_t Crc16_Ccitt(const uint8_t *data, uint8_t len)
+{
+    uint16_t crc = 0xFFFF;
+    uint8_t i;
+
+    while (len--) {
+        crc ^= (uint16_t)(*data++) << 8;
+        for (i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// COBS 解码，格式错误返回 0（帧长度不超过 254，不会出现 0xFF 块）
+uint8_t Cobs_Decode(const uint8_t *in, uint8_t len, uint8_t *out, uint8_t outSize)
+{
+    uint8_t i = 0, o = 0, k, code;
+
+    while (i < len) {
+        code = in[i++];
+        if (code == 0 || i + code - 1 > len) return 0;
+        for (k = 1; k < code; k++) {
+            if (o >= outSize) return 0;
+            out[o++] = in[i++];
+        }
+        if (code != 0xFF && i < len) {
+            if (o >= outSize) return 0;
+            out[o++] = 0;
+        }
+    }
+    return o;
+}
+
+// ============ 命令队列 ============
+void SerialRx_Init(SerialRx *rx, void (*stop)(void))
+{
+    memset(rx, 0, sizeof(*rx));
+    rx->stop = stop;
+}
+
+// 当前行/帧是否为 S / STOP 帧
+static uint8_t SerialRx_IsStop(const SerialRx *rx, uint8_t binary)
+{
+    uint8_t raw[8];
+    uint8_t n;
+
+    if (!binary) return rx->index == 1 && rx->buf[0] == 'S';
+    // STOP 帧只有 4 字节（type, seq, crc16），编码后不超过 6 字节
+    if (rx->index > 6) return 0;
+    n = Cobs_Decode((const uint8_t *)rx->buf, rx->index, raw, sizeof(raw));
+    return n == 4 && raw[0] == FRAME_STOP &&
+           Crc16_Ccitt(raw, 2) == (uint16_t)(raw[2] | (raw[3] << 8));
+}
+
+static void SerialRx_Fill(SerialRx *rx, RxMsg *msg, uint8_t binary)
+{
+    msg->len = rx->index;
+    msg->binary = binary;
+    msg->epoch = rx->stops;
+    memcpy(msg->data, rx->buf, rx->index);
+    msg->data[rx->index] = '\0';
+}
+
+// 当前行/帧组装完成：先识别紧急停车，再放入命令队列
+static void SerialRx_Push(SerialRx *rx, uint8_t binary)
+{
+    uint8_t head = rx->head;
+    uint8_t stop = SerialRx_IsStop(rx, binary);
+
+    if (stop) {
+        rx->stops++;
+        if (rx->stop) rx->stop();
+    }
+
+    if (((head + 1) & (RX_QUEUE_LEN - 1)) == rx->tail) {
+        // 队列满：S / STOP 放进备用槽位（主循环处理完前一个之前不覆盖），其他命令丢弃
+        if (stop && !rx->heldValid) {
+            SerialRx_Fill(rx, &rx->held, binary);
+            rx->heldAt = head;
+            rx->heldValid = 1;
+        } else {
+            rx->dropped++;
+        }
+        return;
+    }
+    SerialRx_Fill(rx, &rx->queue[head], binary);
+    rx->head = (head + 1) & (RX_QUEUE_LEN - 1);
+}
+
+void SerialRx_Byte(SerialRx *rx, uint8_t ch, uint8_t binary)
+{
+    // 二进制模式：以 0x00 分帧；文本模式：以换行分行
+    uint8_t end = binary ? ch == 0 : (ch == '\n' || ch == '\r');
+
+    if (end) {
+        if (rx->index > 0 && !rx->discard) SerialRx_Push(rx, binary);
+        rx->index = 0;
+        rx->discard = 0;
+    } else if (rx->index < RX_MSG_MAX - 1) {
+        rx->buf[rx->index++] = ch;
+    } else {
+        rx->discard = 1;
+    }
+}
+
+// 备用槽位中的停车排在它到达时队列里的命令之后、之后入队的命令之前
+RxMsg *SerialRx_Peek(SerialRx *rx)
+{
+    if (rx->heldValid && rx->tail == rx->heldAt) return &rx->held;
+    if (rx->tail == rx->head) return 0;
+    return &rx->queue[rx->tail];
+}
+
+void SerialRx_Pop(SerialRx *rx)
+{
+    if (rx->heldValid && rx->tail == rx->heldAt) {
+        rx->heldValid = 0;
+    } else if (rx->tail != rx->head) {
+        rx->tail = (rx->tail + 1) & (RX_QUEUE_LEN - 1);
+    }
+}
+
+static uint8_t SerialRx_IsMotionText(const char *s, uint8_t len)
+{
+    if (len >= 2 && s[1] == ',' && memchr("FBLRSV", s[0], 6)) return 1;
+    if (len >= 4 && memcmp(s, "SEQ,", 4) == 0) return 1;
+    return len == 6 && memcmp(s, "LINE,1", 6) == 0;
+}
+
+uint8_t SerialRx_IsMotion(const RxMsg *msg)
+{
+    uint8_t raw[FRAME_MAX_RAW];
+    uint8_t n;
+
+    if (!msg->binary) return SerialRx_IsMotionText(msg->data, msg->len);
+    n = Cobs_Decode((const uint8_t *)msg->data, msg->len, raw, sizeof(raw));
+    if (n < 4) return 0;
+    if (raw[0] == FRAME_MOVE || raw[0] == FRAME_VEL) return 1;
+    return raw[0] == FRAME_TEXT && SerialRx_IsMotionText((const char *)raw + 2, n - 4);
+}
+
+uint8_t SerialRx_Cancelled(const SerialRx *rx, const RxMsg *msg)
+{
+    return msg->epoch != rx->stops && SerialRx_IsMotion(msg);
+}
@@ -0,0 +1,81 @@
+/**
+ * 串口接收：分行/分帧、命令队列、紧急停车识别 - 与硬件无关，固件和主机测试（sim/）共用
+ *
+ * 串口中断逐字节调用 SerialRx_Byte：文本协议以换行分行，二进制协议以 0x00 分帧，
+ * 完整的一行/一帧放入命令队列，主循环取出处理。
+ * 文本 S 和二进制 STOP 帧在入队之前识别并立即调用停车回调；停车之前已在队列中的
+ * 运动命令随之作废（SerialRx_Cancelled），主循环取出后只回 ERR，不再执行。
+ * 队列满时 S / STOP 放进备用槽位，按到达顺序处理，回复照常发出。
+ */
+
+#ifndef __SERIALRX_H
+#define __SERIALRX_H
+
+#include <stdint.h>
+
+// ============ 二进制帧协议 ============
+#define FRAME_MAX_PAYLOAD   48
+#define FRAME_MAX_RAW       (FRAME_MAX_PAYLOAD + 4)
+#define FRAME_MAX_ENCODED   (FRAME_MAX_RAW + 2)
+
+// 主机 → STM32
+#define FRAME_MOVE          0x01    // [dir][pwm, 0=默认][ms:u16]
+#define FRAME_STOP          0x02
+#define FRAME_PING          0x03
+#define FRAME_SENSOR_REQ    0x04
+#define FRAME_VEL           0x05    // [left:i8][right:i8]，-100~100
+#define FRAME_TEXT          0x10    // [文本命令]
+#define FRAME_TEXT_MODE     0x11    // 切回文本协议
+
+// STM32 → 主机
+#define FRAME_ACK           0x81    // [status:0=OK/1=ERR][被应答的 type]
+#define FRAME_PONG          0x82
+#define FRAME_SENSOR        0x83    // [dist:u16][flags][t:u32 ms]
+#define FRAME_TEXT_REPLY    0x90    // [文本回复]
+
+#define SENSOR_FLAG_OBS_L   0x01
+#define SENSOR_FLAG_OBS_R   0x02
+#define SENSOR_FLAG_TRK_L   0x04
+#define SENSOR_FLAG_TRK_R   0x08
+#define SENSOR_FLAG_DIST_BAD 0x10   // 距离不可信（滤波后一致样本不足；旧固件不置位）
+
+uint16_t Crc16_Ccitt(const uint8_t *data, uint8_t len);
+uint8_t Cobs_Decode(const uint8_t *in, uint8_t len, uint8_t *out, uint8_t outSize);
+
+// ============ 命令队列 ============
+#define RX_QUEUE_LEN     8       // 命令队列深度（2 的幂）
+#define RX_MSG_MAX       (FRAME_MAX_ENCODED + 8)
+
+// 一条完整命令：文本行（以 '\0' 结尾，不含换行）或 COBS 帧（不含结尾 0x00）
+typedef struct {
+    uint8_t len;
+    uint8_t binary;
+    uint8_t epoch;                  // 入队时的 stops，与当前值不同说明之后收到过停车
+    char data[RX_MSG_MAX];
+} RxMsg;
+
+typedef struct {
+    char buf[RX_MSG_MAX];           // 中断中组装当前行/帧
+    uint8_t index;
+    uint8_t discard;                // 当前行/帧溢出，丢到下一个分隔符
+    RxMsg queue[RX_QUEUE_LEN];      // 中断写 head，主循环处理完推进 tail
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    volatile uint32_t dropped;      // 队列满丢弃的命令数
+    volatile uint8_t stops;         // 收到的 S / STOP 次数
+    RxMsg held;                     // 队列满时收到的 S / STOP
+    volatile uint8_t heldValid;
+    uint8_t heldAt;                 // 主循环处理到该位置（tail）时先处理 held
+    void (*stop)(void);             // 收到 S / STOP 帧时在中断里调用
+} SerialRx;
+
+void SerialRx_Init(SerialRx *rx, void (*stop)(void));
+void SerialRx_Byte(SerialRx *rx, uint8_t ch, uint8_t binary);
+RxMsg *SerialRx_Peek(SerialRx *rx);     // 队列空返回 0；处理期间该槽位仍归调用者所有
+void SerialRx_Pop(SerialRx *rx);
+// 运动命令（F/B/L/R/S,<ms>、SEQ、V、LINE,1 及对应的 MOVE/VEL/TEXT 帧）
+uint8_t SerialRx_IsMotion(const RxMsg *msg);
+// 入队之后收到过停车的运动命令：不执行
+uint8_t SerialRx_Cancelled(const SerialRx *rx, const RxMsg *msg);
+
+#endif
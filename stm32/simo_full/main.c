@@ -1,41 +1,139 @@
 /**
  * Simo 智能小车 - 全功能固件
  * 
+ * 时间基准：SysTick 1ms，T<ms> 为上电以来的毫秒数
+ * 运动命令设置 PWM 和剩余时间后立即回复 OK，到时由 SysTick 停车；
+ * 运动期间可随时接收新命令，S 或新的运动命令在下一个 1ms 节拍内生效。
+ * PWM 由 TIM4 更新中断按加速度/加加速度限制逐步逼近目标值（1kHz），
+ * 相邻运动之间直接过渡不回零；S 和紧急停车不走斜坡，立即关断
+ * 
+ * 速度模式（V,<左>,<右>）：带符号目标一直保持到被新的设定值替换，适合网页摇杆
+ * 20~50Hz 连续发送；超过看门狗时间（DEADMAN，默认 300ms）没有新设定值就立即停车，
+ * ESP32 或网页断线时车不会一直跑下去
+ * 
+ * 轮速闭环（LOOP,1）：斜坡输出改作两轮目标速度（100% = WHEEL_MAX_SPEED_MM_S），
+ * SysTick 每 10ms 读编码器，PID + 前馈算出 PWM（MotionCtrl.c），电量和地面变化
+ * 不再影响车速；里程计始终积分，ODOM 查询位姿
+ * 
  * 硬件支持：
  *   - 电机控制 (TIM4 PWM: PB6/PB7/PB8/PB9)
  *   - 蜂鸣器 (PB0)
  *   - 红外避障 (PA11左, PA12右)
- *   - 超声波测距 (PB15 TRIG, PB14 ECHO)
+ *   - 超声波测距 (PB15 TRIG, PB14 ECHO；TIM1 计时 + EXTI14，后台每 60ms 测一次，
+ *     最近 5 次做中值/Hampel 滤波并按气温补偿声速)
+ *   - 轮式编码器 (左 PA0/PA1 → TIM2，右 PA6/PA7 → TIM3，编码器模式)
  *   - 红外循迹 (PB13左, PB12右)
  *   - 按键 (PA15)
  * 
+ * 串口接收走 DMA1 通道5 循环缓冲 + IDLE 中断，完整的命令行/帧进入命令队列，
+ * 主循环处理期间到达的命令不会被覆盖；文本 S 和二进制 STOP 帧在中断里直接停车，
+ * 之前排队的运动命令随之作废（回 ERR,stopped / ERR 应答帧），队列满时 S 也不会丢。
+ * 串口发送走 DMA1 通道4 + 环形缓冲，回复只入队不等待；
+ * 回复用轻量格式化函数（Reply_*）拼接，不使用 printf
+ * 
  * 串口协议 (115200bps, PA9 TX, PA10 RX)：
  *   运动控制：
  *     F,<ms>    前进
  *     B,<ms>    后退
  *     L,<ms>    左转
  *     R,<ms>    右转
- *     S         停止
+ *     S         停止（同时清空运动段队列）
+ *     SEQ,<段>[,<段>...]  追加运动段，依次无间隔执行 → OK,SEQ,<首段编号>,<段数>
+ *               段格式 <F/B/L/R/S><ms>[@<pwm>]，S 段为原地停顿，如 SEQ,B300,L400@60,F1000
+ *               每段结束上报 EVT,SEG,<编号>,<剩余段数>；队列空间不足 → ERR,full
+ *     SA        放弃队列中所有运动段并停车 → OK,SA
+ *     V,<l>,<r> 速度设定值：两轮带符号 PWM（-100~100，正=向前；闭环时为目标轮速比例），
+ *               走斜坡过渡并保持到下一个设定值 → OK,V,<l>,<r>；放弃队列并退出巡线，
+ *               F/B/L/R/SEQ/S 退出速度模式
+ *     DEADMAN,<ms>  速度模式看门狗（50~5000，默认 300）：超过该时间没有新的 V 就停车，
+ *               → OK,DEADMAN,<ms>；触发时上报 EVT,DEADMAN
+ *     RAMP,<a>,<j>  PWM 斜坡：a=最大变化率 %/s，j=变化率的最大变化 %/s²，
+ *               0=不限制（a=0 即关闭斜坡）→ OK,RAMP,<a>,<j>
+ *     LOOP,<0/1>  轮速开环/闭环 → OK,LOOP,<0/1>
+ *     LINE,<0/1>  巡线开始/停止 → OK,LINE,<0/1>；完全在 STM32 上以 1kHz 运行，
+ *               任何运动命令或 S 都会退出巡线
+ *               事件：EVT,LAP,<圈数>,<用时 ms>（两侧同时压线的起点标记）、
+ *               EVT,LINE,LOST（两侧长时间看不到线，已停车）
+ *     LINECFG,<pwm>,<kp>,<kd>[,<lostMs>]  巡线参数 → OK,LINECFG,...
+ *     ESTOP,<d>[,<ir>]  反射急停：前进中距离 ≤d（0.1cm，默认 80，0=关闭）或
+ *               红外避障触发（ir=1，默认开）时 STM32 自行停车并清空队列 → OK,ESTOP,<d>,<ir>
+ *               事件：EVT,ESTOP,DIST,<0.1cm> / EVT,ESTOP,IR,<L/R/LR>
+ *     GOV,<d>[,<ir>]  前进限速：前方有效距离（扣除接近速度×0.3s）从 d 降到急停阈值时
+ *               前进速度从 100% 线性降到 30%（0.1cm，默认 600，0=关闭）；红外避障触发后
+ *               速度不超过 ir%（默认 30）→ OK,GOV,<d>,<ir>
+ *     GOV       查询 → GOV,<d>,<ir>,<当前比例 ‰>,<接近速度 mm/s>
+ *     PID,<kp>,<ki>,<kd>[,<kff>]  速度环参数（×1000，PWM% 对 mm/s）→ OK,PID
  *   
  *   传感器读取：
  *     PING      心跳 → PONG
  *     BEEP      蜂鸣器响一声 → OK,BEEP
- *     DIST      超声波距离 → DIST,<0.1cm>
+ *     DIST      超声波距离（滤波结果）→ DIST,<0.1cm>,V<可信 0/1>,T<采样 ms>
  *     IR        红外避障 → IR,L<0/1>R<0/1>
  *     TRACK     红外循迹 → TRACK,L<0/1>R<0/1>
- *     SENSOR    所有传感器 → SENSOR,D<dist>,OL<l>OR<r>,TL<l>TR<r>
+ *     SENSOR    所有传感器 → SENSOR,D<dist>,OL<l>OR<r>,TL<l>TR<r>,T<ms>,V<距离可信 0/1>
+ *     STREAM,<hz> 按固定频率主动上报 SENSOR（1~50Hz，0=停止）→ OK,STREAM,<hz>
  *     KEY       按键状态 → KEY,<0/1>
+ *     TEMP,<t>  设置气温（0.1°C，-400~800，默认 200）用于声速补偿 → OK,TEMP,<t>
+ *     ODOM      里程计 → ODOM,<x mm>,<y mm>,<航向 0.1°>,<左轮 mm/s>,<右轮 mm/s>
+ *     ODOM,RESET  位姿清零 → OK,ODOM
+ *   
+ *   协议切换：
+ *     BIN       切换到二进制帧协议 → OK,BIN（之后收发均为 COBS 帧，
+ *               见 docs/stm32-binary-protocol.md）
  */
 
 #include "stm32f10x.h"
 #include <string.h>
-#include <stdio.h>
 #include <stdlib.h>
+#include "MotionCtrl.h"
+#include "SerialRx.h"
 
 // ============ 配置参数 ============
 #define MOTOR_PWM_SPEED  80      // 电机速度 0-100
 #define MAX_DURATION     3000    // 最大运动时间 ms
 #define MIN_DURATION     50      // 最小运动时间 ms
+#define VEL_DEADMAN_MS   300     // 速度模式：超过该时间没有新的设定值就停车
+#define STREAM_MAX_HZ    50      // 传感器流最高频率
+#define US_PERIOD_MS     60      // 超声波测距周期（HC-SR04 建议 ≥60ms）
+#define US_TRIG_US       12      // 触发脉冲宽度 us
+#define US_MAX_ECHO_US   30000   // 回波超过该宽度视为无回波
+#define US_WINDOW        5       // 滤波窗口（最近 5 次回波，约 300ms）
+#define US_MIN_AGREE     3       // 窗口内至少这么多样本一致，结果才可信
+#define US_HAMPEL_MIN_US 120     // 野值判定的最小容差（约 2cm），避免 MAD≈0 时误杀
+#define US_TEMP_DEFAULT  200     // 默认气温 0.1°C（声速补偿）
+#define TX_RING_SIZE     512     // 串口发送环形缓冲（2 的幂）
+#define RX_DMA_SIZE      128     // 串口接收 DMA 循环缓冲
+#define REPLY_MAX        64      // 单条文本回复最大长度（含 \r\n）
+#define SEG_QUEUE_LEN    16      // 运动段队列深度（2 的幂）
+#define RAMP_ACCEL       400     // PWM 最大变化率 %/s（0→80% 约 200ms）
+#define RAMP_JERK        8000    // PWM 变化率的最大变化 %/s²
+#define RAMP_DIVIDER     20      // TIM4 更新 20kHz / 20 = 1kHz 斜坡节拍
+#define SPEED_LOOP_DEFAULT 0     // 上电默认开环（没装编码器的车也能用）
+#define CTRL_PERIOD_MS   10      // 速度环周期
+#define ENC_TICKS_PER_REV 1560   // 轮子一圈的编码器计数（13 线 × 4 倍频 × 30 减速比）
+#define WHEEL_DIAMETER_MM 65
+#define WHEEL_BASE_MM    130     // 两轮中心距
+#define WHEEL_MAX_SPEED_MM_S 400 // 闭环时 100% 对应的轮速
+#define LINE_DEBOUNCE_MS 3       // 循迹传感器连续这么多个 1ms 节拍一致才认为电平变化
+#define LINE_PWM         45      // 巡线基础速度
+#define LINE_KP          60      // 转向比例：满偏差时两轮差速 %
+#define LINE_KD          20      // 转向微分
+#define LINE_ERR_RATE    8       // 单侧压线时偏差估计每 ms 增长（满量程 1000）
+#define LINE_LOST_MS     1500    // 两侧都这么久没看到线 → 脱线停车
+#define LINE_LAP_MS      20      // 两侧同时压线超过该时间视为起点标记
+#define LINE_LAP_HOLDOFF 1000    // 两次起点标记的最短间隔
+#define ESTOP_MM         80      // 前进中超声波距离不大于该值立即停车（0=不检查距离）
+#define ESTOP_IR         1       // 前进中红外避障触发立即停车
+#define ESTOP_US_CONFIRM 2       // 连续这么多次回波都过近才停车（滤掉单次串扰）
+#define ESTOP_US_STALE_MS 200    // 最新回波超过该时间视为过期，不据此停车
+#define ESTOP_IR_MS      3       // 红外避障连续触发这么多 ms 才停车（去抖）
+#define GOV_MM           600     // 前进限速：有效距离不小于该值全速（0.1cm，0=关闭限速）
+#define GOV_MIN_SCALE    300     // 有效距离降到急停阈值时的速度比例（‰）
+#define GOV_LOOKAHEAD_MS 300     // 有效距离 = 距离 - 接近速度 × 该时间
+#define GOV_UNSURE_SCALE 600     // 距离不可信或过期时的速度比例（‰）
+#define GOV_STALE_MS     300     // 滤波结果超过该时间没更新视为过期
+#define GOV_IR_PWM       30      // 红外避障触发后的速度上限 %
+#define GOV_IR_HOLD_MS   300     // 红外避障最后一次触发后保持限速的时间
 
 // ============ 引脚定义 ============
 // 蜂鸣器
@@ -65,9 +163,138 @@
 #define KEY_PIN          GPIO_Pin_15
 
 // ============ 串口缓冲区 ============
-static char rxBuffer[64];
-static volatile uint8_t rxIndex = 0;
-static volatile uint8_t rxComplete = 0;
+static uint8_t rxDma[RX_DMA_SIZE];             // DMA 循环写入
+static uint8_t rxDmaPos = 0;                   // 中断已处理到的位置
+static SerialRx rx;                            // 分行/分帧 + 命令队列（SerialRx.c）
+static uint8_t rxCancelled = 0;                // 正在处理的是急停之前入队的运动命令
+
+static volatile uint8_t binaryMode = 0;    // 0=文本协议, 1=二进制帧协议
+
+// 文本回复捕获（二进制模式下把文本回复装进 FRAME_TEXT_REPLY）
+static char replyBuffer[FRAME_MAX_PAYLOAD];
+static uint8_t replyLength = 0;
+static uint8_t replyCapture = 0;
+
+// 串口发送环形缓冲：主循环写 txHead，DMA 完成中断推进 txTail
+static uint8_t txRing[TX_RING_SIZE];
+static volatile uint16_t txHead = 0;
+static volatile uint16_t txTail = 0;
+static volatile uint16_t txDmaLen = 0;         // 正在发送的字节数，0=DMA 空闲
+static volatile uint32_t txDropped = 0;        // 缓冲满丢弃的消息数
+
+// 文本回复
+typedef struct {
+    char buf[REPLY_MAX];
+    uint8_t len;
+} Reply;
+
+// ============ 时间基准 / 传感器流 ============
+static volatile uint32_t sysTickMs = 0;
+static volatile uint16_t streamPeriodMs = 0;   // 0=未开启
+static volatile uint16_t streamCounter = 0;
+static volatile uint8_t streamDue = 0;
+static uint8_t streamSeq = 0;
+
+// ============ 运动/蜂鸣器定时（SysTick 中递减，到 0 时关闭） ============
+static volatile uint16_t motionRemainMs = 0;   // 0=电机已停
+static volatile uint16_t buzzerRemainMs = 0;
+
+// 运动段：一段 PWM + 持续时间
+typedef struct {
+    uint8_t left1, left2, right1, right2;
+    uint16_t ms;
+    uint16_t id;
+} MotionSeg;
+
+// 运动段队列：主循环写 segHead，SysTick 取 segTail；清空时关中断
+static MotionSeg segQueue[SEG_QUEUE_LEN];
+static volatile uint8_t segHead = 0;
+static volatile uint8_t segTail = 0;
+static volatile uint8_t segActive = 0;         // 当前运动来自队列
+static volatile uint16_t segCurrentId = 0;
+static volatile uint16_t segDoneId = 0;        // 最近完成的段编号
+static volatile uint16_t segDoneCount = 0;     // SysTick 累计完成段数
+static uint16_t segReported = 0;               // 主循环已上报的完成段数
+static uint16_t segNextId = 1;
+
+// 速度模式（V 命令）：斜坡目标保持到被替换，SysTick 中计时看门狗
+static volatile uint8_t velMode = 0;
+static volatile uint16_t velIdleMs = 0;        // 距上一个设定值的时间
+static volatile uint16_t velDeadmanMs = VEL_DEADMAN_MS;
+static volatile uint16_t velTimeouts = 0;      // 看门狗累计停车次数
+static uint16_t velTimeoutsReported = 0;
+
+// ============ 超声波（EXTI/TIM1 中断中采样，主循环中滤波） ============
+static volatile uint16_t usRaw[US_WINDOW];     // 最近的回波宽度 us，0=无回波
+static volatile uint8_t usRawHead = 0;
+static volatile uint8_t usRawCount = 0;
+static volatile uint16_t usRawSeq = 0;         // 每个新样本加 1
+static volatile uint32_t usRawMs = 0;          // 最新样本的时间
+static uint16_t usRawSeen = 0;
+static volatile int16_t usTemp = US_TEMP_DEFAULT;
+static int usDistance = 0;                     // 滤波结果（0.1cm，0=前方无回波）
+static uint8_t usValid = 0;                    // 滤波结果可信
+static uint32_t usUpdatedMs = 0;               // 滤波结果对应的采样时间
+static volatile uint16_t usEchoStart = 0;      // 回波上升沿时的 TIM1 计数
+static volatile uint8_t usEchoHigh = 0;
+static volatile uint8_t usPending = 0;         // 已触发，等待回波结束
+static uint16_t usCounter = 0;
+
+// ============ 反射急停（TIM4 中断中 1kHz 检查） ============
+static volatile uint16_t estopMm = ESTOP_MM;
+static volatile uint8_t estopIr = ESTOP_IR;
+static volatile uint8_t usNearRun = 0;         // 连续过近回波次数（Ultrasonic_Push 中更新）
+static volatile uint16_t usNearWidth = 0;      // 最近一次过近回波的宽度 us
+static uint8_t estopIrCount = 0;
+static volatile uint8_t estopReason = 0;       // 停车原因（ESTOP_REASON_*），等主循环上报
+static volatile uint16_t estopWidth = 0;       // 停车时的回波宽度 us
+#define ESTOP_REASON_DIST   0x01
+#define ESTOP_REASON_IR_L   0x02
+#define ESTOP_REASON_IR_R   0x04
+
+// ============ 前进限速（主循环算距离比例，TIM4 中断中应用） ============
+static volatile uint16_t govMm = GOV_MM;
+static volatile uint8_t govIrPwm = GOV_IR_PWM;
+static volatile uint16_t govDistScale = GOV_UNSURE_SCALE;  // 按距离/接近速度算出的比例 ‰
+static uint32_t govIrAt = 0;                   // 最近一次红外避障触发的时间
+static uint8_t govIrSeen = 0;
+static uint32_t govSampleMs = 0;               // 已处理的滤波结果时间
+static int32_t govLastDist = 0;
+static int32_t govClosing = 0;                 // 接近速度 mm/s（>0 正在靠近）
+
+// ============ 速度环 / 里程计（SysTick 中更新） ============
+static MotionCtrl motionCtrl;
+static volatile uint8_t speedLoop = SPEED_LOOP_DEFAULT;
+static volatile uint8_t stopEpoch = 0;         // 每次急停加 1，正在计算的速度环输出作废
+static uint16_t encLastLeft = 0, encLastRight = 0;
+static uint16_t ctrlCounter = 0;
+
+static void Motor_SetSpeed(uint8_t left1, uint8_t left2, uint8_t right1, uint8_t right2);
+static void Motor_Stop(void);
+static void Buzzer_Off(void);
+static void Ultrasonic_Trigger(void);
+static void SpeedLoop_Step(void);
+static void Line_Step(void);
+static uint8_t Estop_Check(void);
+static uint16_t Governor_Scale(void);
+
+// ============ 巡线（TIM4 中断中 1kHz 运行） ============
+static volatile uint8_t lineMode = 0;
+static volatile uint8_t linePwm = LINE_PWM;
+static volatile uint16_t lineKp = LINE_KP;
+static volatile uint16_t lineKd = LINE_KD;
+static volatile uint16_t lineLostMs = LINE_LOST_MS;
+static uint8_t lineStable[2];                  // 去抖后的电平（0=黑线），[0]=左 [1]=右
+static uint8_t lineCount[2];
+static int16_t lineErr = 0;                    // 偏差估计：>0 线在左侧
+static int16_t lineErrLast = 0;
+static uint16_t lineSinceSeen = 0;             // 两侧都没看到线的时间 ms
+static uint16_t lineBothMs = 0;                // 两侧同时压线的时间 ms
+static uint32_t lineLapAt = 0;                 // 上一次起点标记的时间
+static volatile uint16_t lineLaps = 0;         // 中断中累计的圈数
+static volatile uint32_t lineLapMs = 0;        // 最近一圈用时（第一次标记为 0）
+static uint16_t lineLapsReported = 0;
+static volatile uint8_t lineLost = 0;          // 脱线停车，等主循环上报
 
 // ============ 延时函数 ============
 static void Delay_us(uint32_t us)
@@ -83,6 +310,61 @@ static void Delay_ms(uint32_t ms)
         Delay_us(1000);
 }
 
+// ============ SysTick ============
+static void SysTick_Init(void)
+{
+    SysTick_Config(SystemCoreClock / 1000);    // 1ms
+}
+
+// 1ms 中断：时间基准、运动/蜂鸣器到时关闭、速度模式看门狗、超声波触发、
+// 传感器流节拍（采样在主循环中进行）、速度环
+void SysTick_Handler(void)
+{
+    sysTickMs++;
+    
+    if (++usCounter >= US_PERIOD_MS) {
+        usCounter = 0;
+        Ultrasonic_Trigger();
+    }
+    
+    if (motionRemainMs && --motionRemainMs == 0) {
+        Motor_SetSpeed(0, 0, 0, 0);
+        if (segActive) {
+            segActive = 0;
+            segDoneId = segCurrentId;
+            segDoneCount++;
+        }
+    }
+    // 运动段在同一节拍内接上（PWM 预装载，下个 PWM 周期生效，无停顿）
+    if (motionRemainMs == 0 && segTail != segHead) {
+        const MotionSeg *seg = &segQueue[segTail];
+        Motor_SetSpeed(seg->left1, seg->left2, seg->right1, seg->right2);
+        segCurrentId = seg->id;
+        segActive = 1;
+        motionRemainMs = seg->ms;
+        segTail = (segTail + 1) & (SEG_QUEUE_LEN - 1);
+    }
+    // 设定值流中断（ESP32/网页断线）：立即停车，不等斜坡
+    if (velMode && ++velIdleMs >= velDeadmanMs) {
+        Motor_Stop();
+        velTimeouts++;
+    }
+    if (buzzerRemainMs && --buzzerRemainMs == 0) {
+        Buzzer_Off();
+    }
+    
+    if (streamPeriodMs && ++streamCounter >= streamPeriodMs) {
+        streamCounter = 0;
+        streamDue = 1;
+    }
+    
+    // 最低优先级，放在最后，不推迟上面的定时
+    if (++ctrlCounter >= CTRL_PERIOD_MS) {
+        ctrlCounter = 0;
+        SpeedLoop_Step();
+    }
+}
+
 // ============ 串口初始化 ============
 static void USART1_Init(void)
 {
@@ -112,7 +394,8 @@ static void USART1_Init(void)
     USART_InitStruct.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;
     USART_Init(USART1, &USART_InitStruct);
     
-    USART_ITConfig(USART1, USART_IT_RXNE, ENABLE);
+    // 接收由 DMA 完成，只用 IDLE 中断判断一段数据结束
+    USART_ITConfig(USART1, USART_IT_IDLE, ENABLE);
     
     NVIC_InitStruct.NVIC_IRQChannel = USART1_IRQn;
     NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 1;
@@ -123,16 +406,286 @@ static void USART1_Init(void)
     USART_Cmd(USART1, ENABLE);
 }
 
-static void USART1_SendChar(char ch)
+// DMA1 通道5 = USART1_RX，循环写入 rxDma；半满/全满中断兜底长数据流
+static void UartRx_Init(void)
+{
+    DMA_InitTypeDef DMA_InitStruct;
+    NVIC_InitTypeDef NVIC_InitStruct;
+    
+    SerialRx_Init(&rx, Motor_Stop);
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+    
+    DMA_InitStruct.DMA_PeripheralBaseAddr = (uint32_t)&USART1->DR;
+    DMA_InitStruct.DMA_MemoryBaseAddr = (uint32_t)rxDma;
+    DMA_InitStruct.DMA_DIR = DMA_DIR_PeripheralSRC;
+    DMA_InitStruct.DMA_BufferSize = RX_DMA_SIZE;
+    DMA_InitStruct.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStruct.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStruct.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    DMA_InitStruct.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+    DMA_InitStruct.DMA_Mode = DMA_Mode_Circular;
+    DMA_InitStruct.DMA_Priority = DMA_Priority_High;
+    DMA_InitStruct.DMA_M2M = DMA_M2M_Disable;
+    DMA_Init(DMA1_Channel5, &DMA_InitStruct);
+    DMA_ITConfig(DMA1_Channel5, DMA_IT_HT | DMA_IT_TC, ENABLE);
+    
+    // 与 USART1 中断同级，互不打断（两者都调用 UartRx_Drain）
+    NVIC_InitStruct.NVIC_IRQChannel = DMA1_Channel5_IRQn;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 1;
+    NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStruct);
+    
+    USART_DMACmd(USART1, USART_DMAReq_Rx, ENABLE);
+    DMA_Cmd(DMA1_Channel5, ENABLE);
+}
+
+// DMA1 通道4 = USART1_TX，每次发送环形缓冲中一段连续数据
+static void UartTx_Init(void)
+{
+    DMA_InitTypeDef DMA_InitStruct;
+    NVIC_InitTypeDef NVIC_InitStruct;
+    
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+    
+    DMA_InitStruct.DMA_PeripheralBaseAddr = (uint32_t)&USART1->DR;
+    DMA_InitStruct.DMA_MemoryBaseAddr = (uint32_t)txRing;
+    DMA_InitStruct.DMA_DIR = DMA_DIR_PeripheralDST;
+    DMA_InitStruct.DMA_BufferSize = 0;
+    DMA_InitStruct.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStruct.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStruct.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    DMA_InitStruct.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+    DMA_InitStruct.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStruct.DMA_Priority = DMA_Priority_Medium;
+    DMA_InitStruct.DMA_M2M = DMA_M2M_Disable;
+    DMA_Init(DMA1_Channel4, &DMA_InitStruct);
+    DMA_ITConfig(DMA1_Channel4, DMA_IT_TC, ENABLE);
+    
+    NVIC_InitStruct.NVIC_IRQChannel = DMA1_Channel4_IRQn;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 2;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStruct);
+    
+    USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE);
+}
+
+// DMA 空闲且有数据时启动下一段（关中断或在 DMA 中断中调用）
+static void UartTx_Kick(void)
+{
+    uint16_t head = txHead;
+    uint16_t tail = txTail;
+    uint16_t n;
+    
+    if (txDmaLen || head == tail) return;
+    
+    // 回绕时先发到缓冲区末尾，剩下的下次再发
+    n = head > tail ? head - tail : TX_RING_SIZE - tail;
+    txDmaLen = n;
+    DMA_Cmd(DMA1_Channel4, DISABLE);
+    DMA1_Channel4->CMAR = (uint32_t)&txRing[tail];
+    DMA_SetCurrDataCounter(DMA1_Channel4, n);
+    DMA_Cmd(DMA1_Channel4, ENABLE);
+}
+
+void DMA1_Channel4_IRQHandler(void)
+{
+    if (DMA_GetITStatus(DMA1_IT_TC4) != RESET) {
+        DMA_ClearITPendingBit(DMA1_IT_TC4);
+        txTail = (txTail + txDmaLen) & (TX_RING_SIZE - 1);
+        txDmaLen = 0;
+        UartTx_Kick();
+    }
+}
+
+// 整条消息入队后立即返回；空间不足时整条丢弃（不会发出半帧）
+static uint8_t UartTx_Write(const uint8_t *data, uint16_t len)
+{
+    uint16_t head = txHead;
+    uint16_t used = (head - txTail) & (TX_RING_SIZE - 1);
+    uint16_t i;
+    
+    if (len > TX_RING_SIZE - 1 - used) {
+        txDropped++;
+        return 0;
+    }
+    for (i = 0; i < len; i++) {
+        txRing[head] = data[i];
+        head = (head + 1) & (TX_RING_SIZE - 1);
+    }
+    txHead = head;
+    
+    __disable_irq();
+    UartTx_Kick();
+    __enable_irq();
+    return 1;
+}
+
+// ============ 回复格式化 ============
+static void Reply_Char(Reply *r, char c)
+{
+    if (r->len < REPLY_MAX - 2) r->buf[r->len++] = c;    // 留出 \r\n
+}
+
+static void Reply_Str(Reply *r, const char *s)
+{
+    while (*s) Reply_Char(r, *s++);
+}
+
+static void Reply_Uint(Reply *r, uint32_t v)
+{
+    char digits[10];
+    uint8_t n = 0;
+    
+    do {
+        digits[n++] = '0' + v % 10;
+        v /= 10;
+    } while (v);
+    while (n) Reply_Char(r, digits[--n]);
+}
+
+static void Reply_Int(Reply *r, int32_t v)
+{
+    if (v < 0) {
+        Reply_Char(r, '-');
+        Reply_Uint(r, 0u - (uint32_t)v);
+    } else {
+        Reply_Uint(r, (uint32_t)v);
+    }
+}
+
+static void Reply_Begin(Reply *r, const char *s)
+{
+    r->len = 0;
+    Reply_Str(r, s);
+}
+
+// 加 \r\n 发出；二进制模式处理 TEXT 帧时装进捕获缓冲
+static void Reply_Send(Reply *r)
+{
+    r->buf[r->len++] = '\r';
+    r->buf[r->len++] = '\n';
+    
+    if (replyCapture) {
+        uint8_t n = r->len;
+        if (n > sizeof(replyBuffer) - replyLength) n = sizeof(replyBuffer) - replyLength;
+        memcpy(replyBuffer + replyLength, r->buf, n);
+        replyLength += n;
+        return;
+    }
+    UartTx_Write((const uint8_t *)r->buf, r->len);
+}
+
+// 固定文本回复
+static void Reply_Line(const char *s)
+{
+    Reply r;
+    Reply_Begin(&r, s);
+    Reply_Send(&r);
+}
+
+// ============ PWM 斜坡 ============
+// 每个轮子一个带符号占空比（正=正转），TIM4 更新中断中向目标逼近：
+// 变化率不超过 rampAccel，变化率本身每毫秒的改变不超过 rampJerk，
+// 剩余距离不够减速时提前减小变化率，到达目标时不过冲
+typedef struct {
+    int32_t pos;                // 当前占空比，0.001%
+    int32_t vel;                // 变化率，0.001%/ms，Q8
+    volatile int8_t target;     // 目标占空比，%
+} Ramp;
+
+static Ramp rampLeft, rampRight;
+static volatile uint16_t rampAccel = RAMP_ACCEL;
+static volatile uint16_t rampJerk = RAMP_JERK;
+static uint8_t rampDivider = 0;
+
+// scale：目标乘以的比例（‰），前进限速用
+static void Ramp_Step(Ramp *r, uint16_t scale)
+{
+    int32_t target = (int32_t)r->target * scale;
+    int32_t err = target - r->pos;
+    int32_t dist = err > 0 ? err : -err;
+    int32_t vmax, dv, want;
+    
+    if (rampAccel == 0) {
+        r->pos = target;
+        r->vel = 0;
+        return;
+    }
+    if (err == 0 && r->vel == 0) return;
+    
+    // %/s = 0.001%/ms；%/s² = 0.001%/ms 每秒
+    vmax = (int32_t)rampAccel << 8;
+    dv = rampJerk ? ((int32_t)rampJerk << 8) / 1000 : vmax;
+    if (dv == 0) dv = 1;
+    
+    // 按 dv 把变化率减到 0 要走 vel²/(2·dv) 的距离
+    want = err > 0 ? vmax : -vmax;
+    if ((r->vel > 0) == (err > 0) &&
+        (int64_t)r->vel * r->vel >= (int64_t)2 * dv * dist * 256) {
+        want = 0;
+    }
+    
+    if (want > r->vel + dv) r->vel += dv;
+    else if (want < r->vel - dv) r->vel -= dv;
+    else r->vel = want;
+    
+    r->pos += r->vel / 256;
+    if ((err > 0 && r->pos >= target) || (err < 0 && r->pos <= target)) {
+        r->pos = target;
+        r->vel = 0;
+    }
+}
+
+// 带符号占空比（-100~100）写入四路 PWM
+static void Motor_WritePwm(int32_t left, int32_t right)
 {
-    while (USART_GetFlagStatus(USART1, USART_FLAG_TXE) == RESET);
-    USART_SendData(USART1, ch);
+    TIM_SetCompare1(TIM4, left > 0 ? left : 0);
+    TIM_SetCompare2(TIM4, left < 0 ? -left : 0);
+    TIM_SetCompare3(TIM4, right > 0 ? right : 0);
+    TIM_SetCompare4(TIM4, right < 0 ? -right : 0);
 }
 
-int fputc(int ch, FILE *f)
+// 闭环时斜坡输出是目标速度，PWM 由速度环写
+static void Ramp_Output(void)
 {
-    USART1_SendChar((char)ch);
-    return ch;
+    if (speedLoop) return;
+    Motor_WritePwm(rampLeft.pos / 1000, rampRight.pos / 1000);
+}
+
+// 与 USART1 同级（抢占优先级 1），串口中断里的紧急停车不会被斜坡覆盖
+static void Ramp_Init(void)
+{
+    NVIC_InitTypeDef NVIC_InitStruct;
+    
+    TIM_ITConfig(TIM4, TIM_IT_Update, ENABLE);
+    NVIC_InitStruct.NVIC_IRQChannel = TIM4_IRQn;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 2;
+    NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStruct);
+}
+
+void TIM4_IRQHandler(void)
+{
+    uint16_t scale;
+    
+    if (TIM_GetITStatus(TIM4, TIM_IT_Update) != RESET) {
+        TIM_ClearITPendingBit(TIM4, TIM_IT_Update);
+        if (++rampDivider < RAMP_DIVIDER) return;
+        rampDivider = 0;
+        if (Estop_Check()) return;
+        if (lineMode) {
+            Line_Step();
+            return;
+        }
+        // 只限制两轮都向前的运动，后退和原地转向不受影响
+        scale = rampLeft.target > 0 && rampRight.target > 0 ? Governor_Scale() : 1000;
+        Ramp_Step(&rampLeft, scale);
+        Ramp_Step(&rampRight, scale);
+        Ramp_Output();
+    }
 }
 
 // ============ 电机初始化 ============
@@ -172,53 +725,184 @@ static void Motor_Init(void)
     TIM_OC4PreloadConfig(TIM4, TIM_OCPreload_Enable);
     TIM_ARRPreloadConfig(TIM4, ENABLE);
     
+    Ramp_Init();
     TIM_Cmd(TIM4, ENABLE);
 }
 
+// 设置目标 PWM（0-100），由斜坡过渡
+// left1=左正转, left2=左反转, right1=右正转, right2=右反转
 static void Motor_SetSpeed(uint8_t left1, uint8_t left2, uint8_t right1, uint8_t right2)
 {
-    TIM_SetCompare1(TIM4, left1);
-    TIM_SetCompare2(TIM4, left2);
-    TIM_SetCompare3(TIM4, right1);
-    TIM_SetCompare4(TIM4, right2);
+    rampLeft.target = (int8_t)((int)left1 - (int)left2);
+    rampRight.target = (int8_t)((int)right1 - (int)right2);
 }
 
-static void Motor_Stop(void) { Motor_SetSpeed(0, 0, 0, 0); }
+// 放弃运动段队列并退出巡线/速度模式，不改变当前 PWM
+static void Motion_Abort(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    
+    __disable_irq();
+    lineMode = 0;
+    velMode = 0;
+    segTail = segHead;
+    segActive = 0;
+    motionRemainMs = 0;
+    __set_PRIMASK(primask);
+}
 
-static void Motor_Forward(uint16_t ms)
+// 停车并清空运动段队列，不走斜坡立即关断（主循环和串口中断都会调用）
+static void Motor_Stop(void)
 {
-    if (ms > MAX_DURATION) ms = MAX_DURATION;
-    if (ms < MIN_DURATION) ms = MIN_DURATION;
-    Motor_SetSpeed(MOTOR_PWM_SPEED, 0, MOTOR_PWM_SPEED, 0);
-    Delay_ms(ms);
-    Motor_Stop();
+    uint32_t primask = __get_PRIMASK();
+    
+    __disable_irq();
+    Motion_Abort();
+    rampLeft.target = rampRight.target = 0;
+    rampLeft.pos = rampRight.pos = 0;
+    rampLeft.vel = rampRight.vel = 0;
+    stopEpoch++;
+    Motor_WritePwm(0, 0);
+    __set_PRIMASK(primask);
 }
 
-static void Motor_Backward(uint16_t ms)
+// 方向 → 四路 PWM；F/B/L/R 之外还有 S（停顿），方向无效返回 0
+static uint8_t Motion_Fill(MotionSeg *seg, char dir, uint8_t pwm, uint16_t ms)
 {
+    if (pwm == 0 || pwm > 100) pwm = MOTOR_PWM_SPEED;
     if (ms > MAX_DURATION) ms = MAX_DURATION;
     if (ms < MIN_DURATION) ms = MIN_DURATION;
-    Motor_SetSpeed(0, MOTOR_PWM_SPEED, 0, MOTOR_PWM_SPEED);
-    Delay_ms(ms);
-    Motor_Stop();
+    
+    seg->left1 = seg->left2 = seg->right1 = seg->right2 = 0;
+    seg->ms = ms;
+    switch (dir) {
+        case 'F': seg->left1 = pwm; seg->right1 = pwm; return 1;
+        case 'B': seg->left2 = pwm; seg->right2 = pwm; return 1;
+        case 'L': seg->right1 = pwm; return 1;              // 只有右轮转
+        case 'R': seg->left1 = pwm; return 1;               // 只有左轮转
+        case 'S': return 1;
+        default:  return 0;
+    }
 }
 
-static void Motor_Left(uint16_t ms)
+// 单条运动命令：放弃队列，从当前 PWM 过渡到新目标并开始计时，立即返回；
+// 到时由 SysTick 停车
+static void Motor_Run(const MotionSeg *seg)
 {
-    if (ms > MAX_DURATION) ms = MAX_DURATION;
-    if (ms < MIN_DURATION) ms = MIN_DURATION;
-    Motor_SetSpeed(0, 0, MOTOR_PWM_SPEED, 0);
-    Delay_ms(ms);
-    Motor_Stop();
+    Motion_Abort();
+    Motor_SetSpeed(seg->left1, seg->left2, seg->right1, seg->right2);
+    motionRemainMs = seg->ms;
 }
 
-static void Motor_Right(uint16_t ms)
+// 追加运动段，空间不足时一段也不加，返回 0
+static uint8_t Motion_Enqueue(const MotionSeg *segs, uint8_t n)
 {
-    if (ms > MAX_DURATION) ms = MAX_DURATION;
-    if (ms < MIN_DURATION) ms = MIN_DURATION;
-    Motor_SetSpeed(MOTOR_PWM_SPEED, 0, 0, 0);
-    Delay_ms(ms);
-    Motor_Stop();
+    uint8_t head = segHead;
+    uint8_t used = (head - segTail) & (SEG_QUEUE_LEN - 1);
+    uint8_t i;
+    
+    if (n > SEG_QUEUE_LEN - 1 - used) return 0;
+    for (i = 0; i < n; i++) {
+        segQueue[head] = segs[i];
+        segQueue[head].id = segNextId++;
+        head = (head + 1) & (SEG_QUEUE_LEN - 1);
+    }
+    segHead = head;
+    return 1;
+}
+
+static uint8_t Motion_Queued(void)
+{
+    return (segHead - segTail) & (SEG_QUEUE_LEN - 1);
+}
+
+// 速度设定值（-100~100）：第一次进入速度模式时放弃队列和巡线，之后只替换斜坡目标，
+// 从当前 PWM 连续过渡；看门狗从这里重新计时
+static void Velocity_Set(int8_t left, int8_t right)
+{
+    uint32_t primask = __get_PRIMASK();
+    
+    __disable_irq();
+    if (!velMode) {
+        Motion_Abort();
+        velMode = 1;
+    }
+    velIdleMs = 0;
+    rampLeft.target = left;
+    rampRight.target = right;
+    __set_PRIMASK(primask);
+}
+
+// ============ 编码器 / 速度环 ============
+// TIM2/TIM3 编码器模式（TI1+TI2 四倍频），16 位计数回绕，每周期取差值；
+// 接线使前进时两轮计数都增加（反了就交换 A/B 相）
+static void Encoder_Init(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct;
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseStruct;
+    TIM_ICInitTypeDef TIM_ICInitStruct;
+    
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2 | RCC_APB1Periph_TIM3, ENABLE);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE);
+    
+    GPIO_InitStruct.GPIO_Pin = GPIO_Pin_0 | GPIO_Pin_1 | GPIO_Pin_6 | GPIO_Pin_7;
+    GPIO_InitStruct.GPIO_Mode = GPIO_Mode_IPU;
+    GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_Init(GPIOA, &GPIO_InitStruct);
+    
+    TIM_TimeBaseStruct.TIM_Period = 0xFFFF;
+    TIM_TimeBaseStruct.TIM_Prescaler = 0;
+    TIM_TimeBaseStruct.TIM_ClockDivision = 0;
+    TIM_TimeBaseStruct.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseInit(TIM2, &TIM_TimeBaseStruct);
+    TIM_TimeBaseInit(TIM3, &TIM_TimeBaseStruct);
+    
+    TIM_EncoderInterfaceConfig(TIM2, TIM_EncoderMode_TI12, TIM_ICPolarity_Rising, TIM_ICPolarity_Rising);
+    TIM_EncoderInterfaceConfig(TIM3, TIM_EncoderMode_TI12, TIM_ICPolarity_Rising, TIM_ICPolarity_Rising);
+    
+    // 输入滤波，滤掉电机 PWM 耦合过来的毛刺
+    TIM_ICStructInit(&TIM_ICInitStruct);
+    TIM_ICInitStruct.TIM_ICFilter = 6;
+    TIM_ICInitStruct.TIM_Channel = TIM_Channel_1;
+    TIM_ICInit(TIM2, &TIM_ICInitStruct);
+    TIM_ICInit(TIM3, &TIM_ICInitStruct);
+    TIM_ICInitStruct.TIM_Channel = TIM_Channel_2;
+    TIM_ICInit(TIM2, &TIM_ICInitStruct);
+    TIM_ICInit(TIM3, &TIM_ICInitStruct);
+    
+    TIM_SetCounter(TIM2, 0);
+    TIM_SetCounter(TIM3, 0);
+    TIM_Cmd(TIM2, ENABLE);
+    TIM_Cmd(TIM3, ENABLE);
+    
+    MotionCtrl_Init(&motionCtrl, 3.14159265f * WHEEL_DIAMETER_MM / ENC_TICKS_PER_REV, WHEEL_BASE_MM);
+}
+
+// SysTick 中每 CTRL_PERIOD_MS 调用：里程计始终积分，闭环时写 PWM。
+// 计算期间串口中断可能急停：stopEpoch 变了就不写，避免把刚关断的电机又打开
+static void SpeedLoop_Step(void)
+{
+    uint16_t left = TIM_GetCounter(TIM2);
+    uint16_t right = TIM_GetCounter(TIM3);
+    uint8_t epoch = stopEpoch;
+    float pwmLeft, pwmRight;
+    uint32_t primask;
+    
+    // 斜坡输出（0.001%）→ 目标轮速 mm/s
+    motionCtrl.targetLeft = rampLeft.pos * (WHEEL_MAX_SPEED_MM_S / 100000.0f);
+    motionCtrl.targetRight = rampRight.pos * (WHEEL_MAX_SPEED_MM_S / 100000.0f);
+    MotionCtrl_Step(&motionCtrl, (int16_t)(left - encLastLeft), (int16_t)(right - encLastRight),
+                    CTRL_PERIOD_MS / 1000.0f, &pwmLeft, &pwmRight);
+    encLastLeft = left;
+    encLastRight = right;
+    
+    if (!speedLoop || lineMode) return;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (epoch == stopEpoch) {
+        Motor_WritePwm((int32_t)pwmLeft, (int32_t)pwmRight);
+    }
+    __set_PRIMASK(primask);
 }
 
 // ============ 蜂鸣器 ============
@@ -237,11 +921,12 @@ static void Buzzer_Init(void)
 static void Buzzer_On(void) { GPIO_SetBits(BUZZER_PORT, BUZZER_PIN); }
 static void Buzzer_Off(void) { GPIO_ResetBits(BUZZER_PORT, BUZZER_PIN); }
 
+// 非阻塞，到时由 SysTick 关闭
 static void Buzzer_Beep(uint16_t ms)
 {
+    buzzerRemainMs = 0;
     Buzzer_On();
-    Delay_ms(ms);
-    Buzzer_Off();
+    buzzerRemainMs = ms;
 }
 
 // ============ 红外避障 ============
@@ -274,11 +959,153 @@ static void IrTracking_Init(void)
 static uint8_t IrTracking_Left(void) { return GPIO_ReadInputDataBit(IR_TRACK_L_PORT, IR_TRACK_L_PIN); }
 static uint8_t IrTracking_Right(void) { return GPIO_ReadInputDataBit(IR_TRACK_R_PORT, IR_TRACK_R_PIN); }
 
+// ============ 反射急停 ============
+// 不依赖 ESP32/后端：每个 1kHz 节拍检查一次，前进（两轮都向前或巡线中）时
+// 最新的原始回波连续过近或红外避障触发就立即停车并清空队列，主循环上报 EVT,ESTOP。
+// 距离用原始回波而不是滤波结果（滑动窗口有约 150ms 的滞后），反应时间 = 回波到达后 ≤1ms；
+// 后退和原地转向不受影响，以便脱困
+
+// TIM4 中断 1kHz 调用，停车返回 1
+static uint8_t Estop_Check(void)
+{
+    uint8_t reason = 0;
+    uint8_t obsL, obsR;
+    
+    if (!lineMode && (rampLeft.target <= 0 || rampRight.target <= 0)) {
+        estopIrCount = 0;
+        return 0;
+    }
+    
+    if (estopMm && usNearRun >= ESTOP_US_CONFIRM &&
+        sysTickMs - usRawMs <= ESTOP_US_STALE_MS) {
+        reason |= ESTOP_REASON_DIST;
+    }
+    if (estopIr) {
+        // 红外避障模块低电平有效
+        obsL = !IrObstacle_Left();
+        obsR = !IrObstacle_Right();
+        if (!obsL && !obsR) {
+            estopIrCount = 0;
+        } else if (++estopIrCount >= ESTOP_IR_MS) {
+            estopIrCount = 0;
+            if (obsL) reason |= ESTOP_REASON_IR_L;
+            if (obsR) reason |= ESTOP_REASON_IR_R;
+        }
+    }
+    if (!reason) return 0;
+    
+    Motor_Stop();
+    estopWidth = usNearWidth;
+    estopReason = reason;
+    return 1;
+}
+
+// ============ 巡线 ============
+// 两个循迹传感器跨在线的两侧：都是白底时车在线上，一侧压线说明车偏向另一侧。
+// 偏差估计 lineErr 在单侧压线期间按 LINE_ERR_RATE 持续增大（压得越久偏得越多），
+// 都是白底时回落；两轮 PWM = 基础速度 ∓ (Kp·偏差 + Kd·偏差变化)，直接写 TIM4。
+// 两侧同时压线是起点标记（计圈），长时间两侧都看不到线视为脱线
+
+// TIM4 中断 1kHz 调用
+static void Line_Step(void)
+{
+    uint8_t raw[2];
+    int32_t steer, left, right, scale;
+    uint8_t i;
+    
+    raw[0] = IrTracking_Left();
+    raw[1] = IrTracking_Right();
+    for (i = 0; i < 2; i++) {
+        if (raw[i] == lineStable[i]) {
+            lineCount[i] = 0;
+        } else if (++lineCount[i] >= LINE_DEBOUNCE_MS) {
+            lineStable[i] = raw[i];
+            lineCount[i] = 0;
+        }
+    }
+    
+    if (!lineStable[0] && !lineStable[1]) {
+        // 起点标记：保持直行
+        lineSinceSeen = 0;
+        if (lineBothMs < 0xFFFF && ++lineBothMs == LINE_LAP_MS &&
+            (lineLaps == 0 || sysTickMs - lineLapAt >= LINE_LAP_HOLDOFF)) {
+            lineLapMs = lineLaps ? sysTickMs - lineLapAt : 0;
+            lineLapAt = sysTickMs;
+            lineLaps++;
+        }
+    } else {
+        lineBothMs = 0;
+        if (!lineStable[0]) {
+            lineSinceSeen = 0;
+            lineErr += LINE_ERR_RATE;
+            if (lineErr > 1000) lineErr = 1000;
+        } else if (!lineStable[1]) {
+            lineSinceSeen = 0;
+            lineErr -= LINE_ERR_RATE;
+            if (lineErr < -1000) lineErr = -1000;
+        } else {
+            lineErr -= lineErr / 64;
+            if (lineSinceSeen < 0xFFFF) lineSinceSeen++;
+        }
+    }
+    
+    if (lineSinceSeen >= lineLostMs) {
+        lineMode = 0;
+        lineLost = 1;
+        Motor_WritePwm(0, 0);
+        return;
+    }
+    
+    steer = ((int32_t)lineKp * lineErr + (int32_t)lineKd * (lineErr - lineErrLast) * 10) / 1000;
+    lineErrLast = lineErr;
+    scale = Governor_Scale();
+    left = ((int32_t)linePwm - steer) * scale / 1000;
+    right = ((int32_t)linePwm + steer) * scale / 1000;
+    if (left > 100) left = 100;
+    if (left < -100) left = -100;
+    if (right > 100) right = 100;
+    if (right < -100) right = -100;
+    Motor_WritePwm(left, right);
+}
+
+// 进入巡线：放弃当前运动，清斜坡，由 TIM4 中断接管电机
+static void Line_Start(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    
+    __disable_irq();
+    Motion_Abort();
+    rampLeft.target = rampRight.target = 0;
+    rampLeft.pos = rampRight.pos = 0;
+    rampLeft.vel = rampRight.vel = 0;
+    lineStable[0] = IrTracking_Left();
+    lineStable[1] = IrTracking_Right();
+    lineCount[0] = lineCount[1] = 0;
+    lineErr = lineErrLast = 0;
+    lineSinceSeen = 0;
+    lineBothMs = LINE_LAP_MS;    // 从起点标记上出发时不计圈
+    lineLaps = 0;
+    lineLapsReported = 0;
+    lineLost = 0;
+    lineMode = 1;
+    __set_PRIMASK(primask);
+}
+
 // ============ 超声波 ============
+// PB14 没有定时器输入捕获通道：ECHO 接 EXTI 双边沿中断，在中断里读取
+// TIM1 自由计数（1MHz）得到回波宽度；TRIG 脉冲由 TIM1 CC1 比较中断结束。
+// （TIM2/TIM3 用于编码器，TIM4 用于电机 PWM）
+// 测距全部在后台进行，DIST/SENSOR 直接返回缓存结果
 static void Ultrasonic_Init(void)
 {
     GPIO_InitTypeDef GPIO_InitStruct;
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE);
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseStruct;
+    TIM_OCInitTypeDef TIM_OCInitStruct;
+    EXTI_InitTypeDef EXTI_InitStruct;
+    NVIC_InitTypeDef NVIC_InitStruct;
+    
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB | RCC_APB2Periph_AFIO, ENABLE);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM1, ENABLE);
     
     // TRIG - 输出
     GPIO_InitStruct.GPIO_Pin = US_TRIG_PIN;
@@ -291,39 +1118,250 @@ static void Ultrasonic_Init(void)
     GPIO_InitStruct.GPIO_Pin = US_ECHO_PIN;
     GPIO_InitStruct.GPIO_Mode = GPIO_Mode_IPD;
     GPIO_Init(US_ECHO_PORT, &GPIO_InitStruct);
+    
+    // TIM1（APB2 72MHz）: 1MHz 自由计数，16 位回绕（65ms）大于最长回波
+    TIM_TimeBaseStruct.TIM_Period = 0xFFFF;
+    TIM_TimeBaseStruct.TIM_Prescaler = 72 - 1;
+    TIM_TimeBaseStruct.TIM_ClockDivision = 0;
+    TIM_TimeBaseStruct.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseStruct.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(TIM1, &TIM_TimeBaseStruct);
+    
+    // CC1 只做比较中断，不输出到引脚
+    TIM_OCInitStruct.TIM_OCMode = TIM_OCMode_Timing;
+    TIM_OCInitStruct.TIM_OutputState = TIM_OutputState_Disable;
+    TIM_OCInitStruct.TIM_Pulse = 0;
+    TIM_OCInitStruct.TIM_OCPolarity = TIM_OCPolarity_High;
+    TIM_OC1Init(TIM1, &TIM_OCInitStruct);
+    TIM_Cmd(TIM1, ENABLE);
+    
+    // ECHO 双边沿中断
+    GPIO_EXTILineConfig(GPIO_PortSourceGPIOB, GPIO_PinSource14);
+    EXTI_InitStruct.EXTI_Line = EXTI_Line14;
+    EXTI_InitStruct.EXTI_Mode = EXTI_Mode_Interrupt;
+    EXTI_InitStruct.EXTI_Trigger = EXTI_Trigger_Rising_Falling;
+    EXTI_InitStruct.EXTI_LineCmd = ENABLE;
+    EXTI_Init(&EXTI_InitStruct);
+    
+    // 边沿时间戳最优先，避免被串口中断拉长
+    NVIC_InitStruct.NVIC_IRQChannel = EXTI15_10_IRQn;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 0;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStruct);
+    
+    NVIC_InitStruct.NVIC_IRQChannel = TIM1_CC_IRQn;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 0;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 1;
+    NVIC_Init(&NVIC_InitStruct);
 }
 
-static int Ultrasonic_Measure(void)
+// 记录一次测量（回波宽度 us，0=无回波）；SysTick 和 EXTI 中调用
+static void Ultrasonic_Push(uint16_t width)
 {
-    uint32_t timeout;
-    uint32_t time_us = 0;
-    int distance;
+    uint32_t nearUs = (uint32_t)estopMm * 20000 / (3313 + (int32_t)usTemp * 606 / 1000);
     
-    // 发送触发脉冲
+    if (width != 0 && width <= nearUs) {
+        if (usNearRun < 0xFF) usNearRun++;
+        usNearWidth = width;
+    } else {
+        usNearRun = 0;
+    }
+    usRaw[usRawHead] = width;
+    usRawHead = (usRawHead + 1) % US_WINDOW;
+    if (usRawCount < US_WINDOW) usRawCount++;
+    usRawMs = sysTickMs;
+    usRawSeq++;
+}
+
+// SysTick 中调用：发出触发脉冲，上一次没有等到回波结束则记为无回波
+static void Ultrasonic_Trigger(void)
+{
+    // 关中断：避免与 EXTI 同时判断 usPending 记两次
+    __disable_irq();
+    if (usPending) {
+        Ultrasonic_Push(0);
+        usEchoHigh = 0;
+    }
+    usPending = 1;
     GPIO_SetBits(US_TRIG_PORT, US_TRIG_PIN);
-    Delay_us(15);
-    GPIO_ResetBits(US_TRIG_PORT, US_TRIG_PIN);
+    TIM_ClearITPendingBit(TIM1, TIM_IT_CC1);
+    TIM_SetCompare1(TIM1, TIM_GetCounter(TIM1) + US_TRIG_US);
+    TIM_ITConfig(TIM1, TIM_IT_CC1, ENABLE);
+    __enable_irq();
+}
+
+// 触发脉冲结束
+void TIM1_CC_IRQHandler(void)
+{
+    if (TIM_GetITStatus(TIM1, TIM_IT_CC1) != RESET) {
+        TIM_ClearITPendingBit(TIM1, TIM_IT_CC1);
+        TIM_ITConfig(TIM1, TIM_IT_CC1, DISABLE);
+        GPIO_ResetBits(US_TRIG_PORT, US_TRIG_PIN);
+    }
+}
+
+// ECHO 边沿：上升沿记起点，下降沿算宽度
+void EXTI15_10_IRQHandler(void)
+{
+    uint16_t now;
+    uint16_t width;
+    
+    if (EXTI_GetITStatus(EXTI_Line14) != RESET) {
+        now = TIM_GetCounter(TIM1);
+        EXTI_ClearITPendingBit(EXTI_Line14);
+        
+        if (GPIO_ReadInputDataBit(US_ECHO_PORT, US_ECHO_PIN)) {
+            usEchoStart = now;
+            usEchoHigh = 1;
+        } else if (usEchoHigh && usPending) {
+            width = now - usEchoStart;    // 16 位回绕相减
+            usEchoHigh = 0;
+            usPending = 0;
+            Ultrasonic_Push(width > US_MAX_ECHO_US ? 0 : width);
+        }
+    }
+}
+
+// 插入排序（窗口只有几个样本）
+static void Ultrasonic_Sort(uint16_t *v, uint8_t n)
+{
+    uint8_t i, j;
+    uint16_t x;
+    
+    for (i = 1; i < n; i++) {
+        x = v[i];
+        for (j = i; j > 0 && v[j - 1] > x; j--) v[j] = v[j - 1];
+        v[j] = x;
+    }
+}
+
+// 主循环中调用：有新样本时重新计算滤波结果。
+// HC-SR04 两次触发至少间隔 60ms（否则会收到上一次的余波），不能真正连发，
+// 用最近 US_WINDOW 次测量的滑动窗口代替突发采样：
+//   - 多数样本无回波 → 前方空旷（0）
+//   - 否则对有回波的样本做 Hampel 检验：偏离中值超过 3×1.4826×MAD 的是野值，
+//     剩余样本取平均；一致样本不足 US_MIN_AGREE 个时标记为不可信
+// 宽度按气温换算距离：声速 = 331.3 + 0.606×T m/s
+static void Ultrasonic_Update(void)
+{
+    uint16_t echo[US_WINDOW];
+    uint16_t dev[US_WINDOW];
+    uint16_t seq, med, tol, w;
+    uint32_t sum = 0, sampleMs, speed;
+    uint8_t n, count = 0, echoes = 0, i;
+    uint32_t primask;
+    
+    if (usRawSeq == usRawSeen) return;
+    
+    primask = __get_PRIMASK();
+    __disable_irq();
+    seq = usRawSeq;
+    n = usRawCount;
+    sampleMs = usRawMs;
+    for (i = 0; i < n; i++) {
+        if (usRaw[i]) echo[echoes++] = usRaw[i];
+    }
+    __set_PRIMASK(primask);
+    usRawSeen = seq;
     
-    // 等待ECHO变高
-    timeout = 10000;
-    while(GPIO_ReadInputDataBit(US_ECHO_PORT, US_ECHO_PIN) == 0) {
-        Delay_us(1);
-        if(--timeout == 0) return 0;
+    if (echoes * 2 <= n) {
+        usDistance = 0;
+        usValid = n - echoes >= US_MIN_AGREE;
+        usUpdatedMs = sampleMs;
+        return;
     }
     
-    // 测量ECHO高电平时间
-    timeout = 30000;
-    while(GPIO_ReadInputDataBit(US_ECHO_PORT, US_ECHO_PIN) == 1) {
-        Delay_us(1);
-        time_us++;
-        if(--timeout == 0) return 0;
+    Ultrasonic_Sort(echo, echoes);
+    med = echo[echoes / 2];
+    for (i = 0; i < echoes; i++) {
+        dev[i] = echo[i] > med ? echo[i] - med : med - echo[i];
     }
+    Ultrasonic_Sort(dev, echoes);
+    tol = (uint16_t)((uint32_t)dev[echoes / 2] * 445 / 100);
+    if (tol < US_HAMPEL_MIN_US) tol = US_HAMPEL_MIN_US;
     
-    // 计算距离 (0.1cm)
-    distance = (time_us * 34) / 200;
-    if(distance > 4000) distance = 4000;
+    for (i = 0; i < echoes; i++) {
+        w = echo[i] > med ? echo[i] - med : med - echo[i];
+        if (w <= tol) {
+            sum += echo[i];
+            count++;
+        }
+    }
+    // 距离(mm = 0.1cm) = us × 声速(0.1m/s) / 20000
+    speed = 3313 + (int32_t)usTemp * 606 / 1000;
+    usDistance = (int)(sum / count * speed / 20000);
+    if (usDistance > 4000) usDistance = 4000;
+    usValid = count >= US_MIN_AGREE;
+    usUpdatedMs = sampleMs;
+}
+
+// 最近一次滤波结果（0.1cm，0=无回波），不等待
+static int Ultrasonic_Distance(void)
+{
+    return usDistance;
+}
+
+// ============ 前进限速 ============
+// 前进速度按前方余量连续缩放，空旷处全速，靠近障碍逐渐减速，余下的交给反射急停：
+//   有效距离 = 滤波距离 - 接近速度 × GOV_LOOKAHEAD_MS（迎面而来的障碍提前减速）
+//   有效距离 ≥ govMm 全速，降到急停阈值时为 GOV_MIN_SCALE，中间线性
+// 距离不可信或过期时限速 GOV_UNSURE_SCALE；红外避障触发后 GOV_IR_HOLD_MS 内速度不超过 govIrPwm
+// 作用在斜坡目标（闭环时即目标轮速）和巡线基础速度上，减速同样走斜坡
+
+// 主循环中调用（Ultrasonic_Update 之后）
+static void Governor_Update(void)
+{
+    int32_t dist = usDistance;
+    int32_t dt, v, eff, lo;
+    uint16_t scale;
     
-    return distance;
+    if (usUpdatedMs != govSampleMs) {
+        dt = (int32_t)(usUpdatedMs - govSampleMs);
+        if (usValid && dist > 0 && govLastDist > 0 && dt > 0 && dt <= GOV_STALE_MS) {
+            v = (govLastDist - dist) * 1000 / dt;
+            govClosing += (v - govClosing) / 2;
+        } else {
+            govClosing = 0;
+        }
+        govLastDist = usValid ? dist : 0;
+        govSampleMs = usUpdatedMs;
+    }
+    
+    if (!usValid || sysTickMs - usUpdatedMs > GOV_STALE_MS) {
+        scale = GOV_UNSURE_SCALE;
+    } else if (dist == 0) {
+        scale = 1000;                     // 前方无回波
+    } else {
+        eff = dist - (govClosing > 0 ? govClosing * GOV_LOOKAHEAD_MS / 1000 : 0);
+        lo = estopMm;
+        if (eff >= govMm) {
+            scale = 1000;
+        } else if (eff <= lo) {
+            scale = GOV_MIN_SCALE;
+        } else {
+            scale = (uint16_t)(GOV_MIN_SCALE + (1000 - GOV_MIN_SCALE) * (eff - lo) / (govMm - lo));
+        }
+    }
+    govDistScale = scale;
+}
+
+// TIM4 中断 1kHz 调用：当前前进速度比例（‰）
+static uint16_t Governor_Scale(void)
+{
+    uint16_t scale;
+    
+    if (govMm == 0) return 1000;
+    scale = govDistScale;
+    // 红外避障模块低电平有效
+    if (!IrObstacle_Left() || !IrObstacle_Right()) {
+        govIrAt = sysTickMs;
+        govIrSeen = 1;
+    }
+    if (govIrSeen && sysTickMs - govIrAt < GOV_IR_HOLD_MS && scale > govIrPwm * 10) {
+        scale = govIrPwm * 10;
+    }
+    return scale;
 }
 
 // ============ 按键 ============
@@ -340,6 +1378,158 @@ static void Key_Init(void)
 
 static uint8_t Key_Read(void) { return !GPIO_ReadInputDataBit(KEY_PORT, KEY_PIN); }
 
+// 执行运动命令，pwm=0 使用默认速度；方向无效返回 0
+static uint8_t Motion_Run(char dir, uint8_t pwm, uint16_t ms)
+{
+    MotionSeg seg;
+    
+    if (dir == 'S' || !Motion_Fill(&seg, dir, pwm, ms)) return 0;
+    Motor_Run(&seg);
+    return 1;
+}
+
+// 解析 SEQ 参数：<dir><ms>[@<pwm>],...，格式错误返回 0
+static uint8_t Motion_ParseSeq(char *p, MotionSeg *segs, uint8_t max, uint8_t *count)
+{
+    uint8_t n = 0;
+    char dir;
+    unsigned long ms, pwm;
+    
+    while (*p) {
+        if (n >= max) return 0;
+        dir = *p++;
+        if (*p < '0' || *p > '9') return 0;
+        ms = strtoul(p, &p, 10);
+        pwm = 0;
+        if (*p == '@') pwm = strtoul(p + 1, &p, 10);
+        if (!Motion_Fill(&segs[n], dir, (uint8_t)(pwm > 100 ? 0 : pwm),
+                         (uint16_t)(ms > MAX_DURATION ? MAX_DURATION : ms))) {
+            return 0;
+        }
+        n++;
+        if (*p == ',') p++;
+        else if (*p) return 0;
+    }
+    *count = n;
+    return n > 0;
+}
+
+// ============ 传感器上报 ============
+static void Sensor_ReportText(void)
+{
+    uint32_t t = sysTickMs;
+    int dist = Ultrasonic_Distance();
+    uint8_t obsL = IrObstacle_Left();
+    uint8_t obsR = IrObstacle_Right();
+    uint8_t trkL = IrTracking_Left();
+    uint8_t trkR = IrTracking_Right();
+    Reply r;
+    
+    Reply_Begin(&r, "SENSOR,D");
+    Reply_Int(&r, dist);
+    Reply_Str(&r, ",OL");
+    Reply_Uint(&r, obsL);
+    Reply_Str(&r, "OR");
+    Reply_Uint(&r, obsR);
+    Reply_Str(&r, ",TL");
+    Reply_Uint(&r, trkL);
+    Reply_Str(&r, "TR");
+    Reply_Uint(&r, trkR);
+    Reply_Str(&r, ",T");
+    Reply_Uint(&r, t);
+    Reply_Str(&r, ",V");
+    Reply_Uint(&r, usValid);
+    Reply_Send(&r);
+}
+
+static void Frame_SendSensor(uint8_t seq);
+static void Frame_Send(uint8_t type, uint8_t seq, const uint8_t *payload, uint8_t len);
+
+// 主动上报事件：文本模式发一行，二进制模式装进 TEXT_REPLY 帧（seq=0）
+static void Event_Send(Reply *r)
+{
+    if (binaryMode) {
+        Frame_Send(FRAME_TEXT_REPLY, 0, (const uint8_t *)r->buf, r->len);
+    } else {
+        Reply_Send(r);
+    }
+}
+
+// 反射急停事件：EVT,ESTOP,DIST,<0.1cm> / EVT,ESTOP,IR,<L/R/LR>
+static void Event_Estop(void)
+{
+    Reply r;
+    uint8_t reason = estopReason;
+    
+    if (!reason) return;
+    estopReason = 0;
+    if (reason & ESTOP_REASON_DIST) {
+        Reply_Begin(&r, "EVT,ESTOP,DIST,");
+        Reply_Uint(&r, (uint32_t)estopWidth * (3313 + (int32_t)usTemp * 606 / 1000) / 20000);
+        Event_Send(&r);
+    }
+    if (reason & (ESTOP_REASON_IR_L | ESTOP_REASON_IR_R)) {
+        Reply_Begin(&r, "EVT,ESTOP,IR,");
+        if (reason & ESTOP_REASON_IR_L) Reply_Char(&r, 'L');
+        if (reason & ESTOP_REASON_IR_R) Reply_Char(&r, 'R');
+        Event_Send(&r);
+    }
+}
+
+// 巡线事件：EVT,LAP,<圈数>,<用时 ms> / EVT,LINE,LOST
+static void Event_Line(void)
+{
+    Reply r;
+    uint16_t laps = lineLaps;
+    
+    if (laps != lineLapsReported) {
+        lineLapsReported = laps;
+        Reply_Begin(&r, "EVT,LAP,");
+        Reply_Uint(&r, laps);
+        Reply_Char(&r, ',');
+        Reply_Uint(&r, lineLapMs);
+        Event_Send(&r);
+    }
+    if (lineLost) {
+        lineLost = 0;
+        Reply_Begin(&r, "EVT,LINE,LOST");
+        Event_Send(&r);
+    }
+}
+
+// 速度模式看门狗停车事件：EVT,DEADMAN
+static void Event_Deadman(void)
+{
+    Reply r;
+    
+    if (velTimeoutsReported == velTimeouts) return;
+    velTimeoutsReported = velTimeouts;
+    Reply_Begin(&r, "EVT,DEADMAN");
+    Event_Send(&r);
+}
+
+// 运动段完成事件
+static void Event_SegmentDone(void)
+{
+    Reply r;
+    
+    if (segReported == segDoneCount) return;
+    segReported = segDoneCount;
+    Reply_Begin(&r, "EVT,SEG,");
+    Reply_Uint(&r, segDoneId);
+    Reply_Char(&r, ',');
+    Reply_Uint(&r, Motion_Queued());
+    Event_Send(&r);
+}
+
+static void Reply_Unknown(const char *cmd)
+{
+    Reply r;
+    Reply_Begin(&r, "ERR,unknown:");
+    Reply_Str(&r, cmd);
+    Reply_Send(&r);
+}
+
 // ============ 命令处理 ============
 static void ProcessCommand(char *cmd)
 {
@@ -352,64 +1542,394 @@ static void ProcessCommand(char *cmd)
     }
     if (len == 0) return;
     
+    // 急停之前入队的运动命令不再执行，只回 ERR（应答仍与命令一一对应）
+    if (rxCancelled) {
+        Reply_Line("ERR,stopped");
+        return;
+    }
+    
     // S - 停止
     if (strcmp(cmd, "S") == 0) {
         Motor_Stop();
-        printf("OK,S\r\n");
+        Reply_Line("OK,S");
         return;
     }
     
     // PING - 心跳
     if (strcmp(cmd, "PING") == 0) {
-        printf("PONG\r\n");
+        Reply_Line("PONG");
         return;
     }
     
     // BEEP - 蜂鸣器
     if (strcmp(cmd, "BEEP") == 0) {
         Buzzer_Beep(100);
-        printf("OK,BEEP\r\n");
+        Reply_Line("OK,BEEP");
         return;
     }
     
     // DIST - 超声波距离
     if (strcmp(cmd, "DIST") == 0) {
-        int dist = Ultrasonic_Measure();
-        printf("DIST,%d\r\n", dist);
+        Reply r;
+        Reply_Begin(&r, "DIST,");
+        Reply_Int(&r, Ultrasonic_Distance());
+        Reply_Str(&r, ",V");
+        Reply_Uint(&r, usValid);
+        Reply_Str(&r, ",T");
+        Reply_Uint(&r, usUpdatedMs);
+        Reply_Send(&r);
         return;
     }
     
     // IR - 红外避障
     if (strcmp(cmd, "IR") == 0) {
-        uint8_t left = IrObstacle_Left();
-        uint8_t right = IrObstacle_Right();
-        printf("IR,L%dR%d\r\n", left, right);
+        Reply r;
+        Reply_Begin(&r, "IR,L");
+        Reply_Uint(&r, IrObstacle_Left());
+        Reply_Char(&r, 'R');
+        Reply_Uint(&r, IrObstacle_Right());
+        Reply_Send(&r);
         return;
     }
     
     // TRACK - 红外循迹
     if (strcmp(cmd, "TRACK") == 0) {
-        uint8_t left = IrTracking_Left();
-        uint8_t right = IrTracking_Right();
-        printf("TRACK,L%dR%d\r\n", left, right);
+        Reply r;
+        Reply_Begin(&r, "TRACK,L");
+        Reply_Uint(&r, IrTracking_Left());
+        Reply_Char(&r, 'R');
+        Reply_Uint(&r, IrTracking_Right());
+        Reply_Send(&r);
         return;
     }
     
     // KEY - 按键状态
     if (strcmp(cmd, "KEY") == 0) {
-        uint8_t key = Key_Read();
-        printf("KEY,%d\r\n", key);
+        Reply r;
+        Reply_Begin(&r, "KEY,");
+        Reply_Uint(&r, Key_Read());
+        Reply_Send(&r);
         return;
     }
     
     // SENSOR - 所有传感器
     if (strcmp(cmd, "SENSOR") == 0) {
-        int dist = Ultrasonic_Measure();
-        uint8_t obsL = IrObstacle_Left();
-        uint8_t obsR = IrObstacle_Right();
-        uint8_t trkL = IrTracking_Left();
-        uint8_t trkR = IrTracking_Right();
-        printf("SENSOR,D%d,OL%dOR%d,TL%dTR%d\r\n", dist, obsL, obsR, trkL, trkR);
+        Sensor_ReportText();
+        return;
+    }
+    
+    // STREAM,<hz> - 传感器流
+    if (strncmp(cmd, "STREAM,", 7) == 0) {
+        int hz = atoi(cmd + 7);
+        Reply r;
+        if (hz < 0 || hz > STREAM_MAX_HZ) {
+            Reply_Begin(&r, "ERR,range:");
+            Reply_Str(&r, cmd);
+            Reply_Send(&r);
+            return;
+        }
+        streamCounter = 0;
+        streamPeriodMs = hz ? 1000 / hz : 0;
+        Reply_Begin(&r, "OK,STREAM,");
+        Reply_Int(&r, hz);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // SEQ - 追加运动段
+    if (strncmp(cmd, "SEQ,", 4) == 0) {
+        MotionSeg segs[SEG_QUEUE_LEN - 1];
+        uint8_t n;
+        uint16_t firstId = segNextId;
+        Reply r;
+        
+        if (!Motion_ParseSeq(cmd + 4, segs, SEG_QUEUE_LEN - 1, &n)) {
+            Reply_Unknown(cmd);
+            return;
+        }
+        if (lineMode || velMode) Motor_Stop();     // 运动段不与巡线/速度模式混用
+        if (!Motion_Enqueue(segs, n)) {
+            Reply_Line("ERR,full");
+            return;
+        }
+        Reply_Begin(&r, "OK,SEQ,");
+        Reply_Uint(&r, firstId);
+        Reply_Char(&r, ',');
+        Reply_Uint(&r, n);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // TEMP,<0.1°C> - 超声波声速补偿用的气温
+    if (strncmp(cmd, "TEMP,", 5) == 0) {
+        char *end;
+        long temp = strtol(cmd + 5, &end, 10);
+        Reply r;
+        
+        if (end == cmd + 5 || *end != '\0' || temp < -400 || temp > 800) {
+            Reply_Begin(&r, "ERR,range:");
+            Reply_Str(&r, cmd);
+            Reply_Send(&r);
+            return;
+        }
+        usTemp = (int16_t)temp;
+        usRawSeen = usRawSeq - 1;    // 按新声速重新计算
+        Reply_Begin(&r, "OK,TEMP,");
+        Reply_Int(&r, usTemp);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // RAMP,<a>,<j> - PWM 斜坡参数
+    if (strncmp(cmd, "RAMP,", 5) == 0) {
+        char *p = cmd + 5;
+        unsigned long accel = strtoul(p, &p, 10);
+        unsigned long jerk = *p == ',' ? strtoul(p + 1, &p, 10) : rampJerk;
+        Reply r;
+        
+        if (accel > 65535 || jerk > 65535) {
+            Reply_Begin(&r, "ERR,range:");
+            Reply_Str(&r, cmd);
+            Reply_Send(&r);
+            return;
+        }
+        rampAccel = (uint16_t)accel;
+        rampJerk = (uint16_t)jerk;
+        Reply_Begin(&r, "OK,RAMP,");
+        Reply_Uint(&r, rampAccel);
+        Reply_Char(&r, ',');
+        Reply_Uint(&r, rampJerk);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // ESTOP,<mm>[,<ir>] - 反射急停阈值（0.1cm，0=不检查距离），ir=红外避障是否参与
+    if (strncmp(cmd, "ESTOP,", 6) == 0) {
+        char *p = cmd + 6;
+        long mm = strtol(p, &p, 10);
+        long ir = *p == ',' ? strtol(p + 1, &p, 10) : estopIr;
+        Reply r;
+        
+        if (*p != '\0' || mm < 0 || mm > 1000 || ir < 0 || ir > 1) {
+            Reply_Begin(&r, "ERR,range:");
+            Reply_Str(&r, cmd);
+            Reply_Send(&r);
+            return;
+        }
+        estopMm = (uint16_t)mm;
+        estopIr = (uint8_t)ir;
+        Reply_Begin(&r, "OK,ESTOP,");
+        Reply_Uint(&r, estopMm);
+        Reply_Char(&r, ',');
+        Reply_Uint(&r, estopIr);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // GOV - 查询前进限速 → GOV,<全速距离>,<红外限速>,<当前比例 ‰>,<接近速度 mm/s>
+    if (strcmp(cmd, "GOV") == 0) {
+        Reply r;
+        Reply_Begin(&r, "GOV,");
+        Reply_Uint(&r, govMm);
+        Reply_Char(&r, ',');
+        Reply_Uint(&r, govIrPwm);
+        Reply_Char(&r, ',');
+        Reply_Uint(&r, govDistScale);
+        Reply_Char(&r, ',');
+        Reply_Int(&r, govClosing);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // GOV,<d>[,<ir>] - 前进限速：d=全速距离（0.1cm，0=关闭），ir=红外避障触发后的速度上限 %
+    if (strncmp(cmd, "GOV,", 4) == 0) {
+        char *p = cmd + 4;
+        long mm = strtol(p, &p, 10);
+        long ir = *p == ',' ? strtol(p + 1, &p, 10) : govIrPwm;
+        Reply r;
+        
+        if (*p != '\0' || mm < 0 || mm > 4000 || ir < 0 || ir > 100) {
+            Reply_Begin(&r, "ERR,range:");
+            Reply_Str(&r, cmd);
+            Reply_Send(&r);
+            return;
+        }
+        govMm = (uint16_t)mm;
+        govIrPwm = (uint8_t)ir;
+        Reply_Begin(&r, "OK,GOV,");
+        Reply_Uint(&r, govMm);
+        Reply_Char(&r, ',');
+        Reply_Uint(&r, govIrPwm);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // LINE,<0/1> - 巡线开始/停止
+    if (strcmp(cmd, "LINE,1") == 0) {
+        Line_Start();
+        Reply_Line("OK,LINE,1");
+        return;
+    }
+    if (strcmp(cmd, "LINE,0") == 0) {
+        Motor_Stop();
+        Reply_Line("OK,LINE,0");
+        return;
+    }
+    
+    // LINECFG,<pwm>,<kp>,<kd>[,<lostMs>] - 巡线参数
+    if (strncmp(cmd, "LINECFG,", 8) == 0) {
+        char *p = cmd + 8;
+        long pwm = strtol(p, &p, 10);
+        long kp = *p == ',' ? strtol(p + 1, &p, 10) : -1;
+        long kd = *p == ',' ? strtol(p + 1, &p, 10) : -1;
+        long lost = *p == ',' ? strtol(p + 1, &p, 10) : lineLostMs;
+        Reply r;
+        
+        if (*p != '\0' || pwm < 0 || pwm > 100 || kp < 0 || kp > 1000 ||
+            kd < 0 || kd > 1000 || lost < 50 || lost > 60000) {
+            Reply_Begin(&r, "ERR,range:");
+            Reply_Str(&r, cmd);
+            Reply_Send(&r);
+            return;
+        }
+        linePwm = (uint8_t)pwm;
+        lineKp = (uint16_t)kp;
+        lineKd = (uint16_t)kd;
+        lineLostMs = (uint16_t)lost;
+        Reply_Begin(&r, "OK,LINECFG,");
+        Reply_Uint(&r, linePwm);
+        Reply_Char(&r, ',');
+        Reply_Uint(&r, lineKp);
+        Reply_Char(&r, ',');
+        Reply_Uint(&r, lineKd);
+        Reply_Char(&r, ',');
+        Reply_Uint(&r, lineLostMs);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // LOOP,<0/1> - 轮速开环/闭环
+    if (strncmp(cmd, "LOOP,", 5) == 0 && (cmd[5] == '0' || cmd[5] == '1') && cmd[6] == '\0') {
+        Reply r;
+        speedLoop = cmd[5] - '0';
+        Reply_Begin(&r, "OK,LOOP,");
+        Reply_Uint(&r, speedLoop);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // PID,<kp>,<ki>,<kd>[,<kff>] - 速度环参数（×1000）
+    if (strncmp(cmd, "PID,", 4) == 0) {
+        char *p = cmd + 4;
+        long kp = strtol(p, &p, 10);
+        long ki = *p == ',' ? strtol(p + 1, &p, 10) : -1;
+        long kd = *p == ',' ? strtol(p + 1, &p, 10) : -1;
+        long kff = *p == ',' ? strtol(p + 1, &p, 10) : (long)(motionCtrl.left.kff * 1000);
+        uint32_t primask;
+        
+        if (kp < 0 || ki < 0 || kd < 0 || kff < 0 || *p != '\0') {
+            Reply_Unknown(cmd);
+            return;
+        }
+        primask = __get_PRIMASK();
+        __disable_irq();
+        Pid_Init(&motionCtrl.left, kp / 1000.0f, ki / 1000.0f, kd / 1000.0f, kff / 1000.0f,
+                 motionCtrl.left.outLimit);
+        motionCtrl.right = motionCtrl.left;
+        __set_PRIMASK(primask);
+        Reply_Line("OK,PID");
+        return;
+    }
+    
+    // ODOM - 里程计位姿；ODOM,RESET - 清零
+    if (strcmp(cmd, "ODOM") == 0) {
+        Odometry odom;
+        float vl, vr;
+        uint32_t primask = __get_PRIMASK();
+        Reply r;
+        
+        __disable_irq();
+        odom = motionCtrl.odom;
+        vl = motionCtrl.speedLeft;
+        vr = motionCtrl.speedRight;
+        __set_PRIMASK(primask);
+        
+        Reply_Begin(&r, "ODOM,");
+        Reply_Int(&r, (int32_t)odom.x);
+        Reply_Char(&r, ',');
+        Reply_Int(&r, (int32_t)odom.y);
+        Reply_Char(&r, ',');
+        Reply_Int(&r, (int32_t)(odom.heading * (1800.0f / 3.14159265f)));
+        Reply_Char(&r, ',');
+        Reply_Int(&r, (int32_t)vl);
+        Reply_Char(&r, ',');
+        Reply_Int(&r, (int32_t)vr);
+        Reply_Send(&r);
+        return;
+    }
+    if (strcmp(cmd, "ODOM,RESET") == 0) {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        Odom_Reset(&motionCtrl.odom);
+        __set_PRIMASK(primask);
+        Reply_Line("OK,ODOM");
+        return;
+    }
+    
+    // SA - 放弃运动段队列
+    if (strcmp(cmd, "SA") == 0) {
+        Motor_Stop();
+        Reply_Line("OK,SA");
+        return;
+    }
+    
+    // V,<left>,<right> - 速度设定值（-100~100）
+    if (strncmp(cmd, "V,", 2) == 0) {
+        char *p = cmd + 2;
+        long left = strtol(p, &p, 10);
+        long right = *p == ',' ? strtol(p + 1, &p, 10) : 1000;
+        Reply r;
+        
+        if (*p != '\0' || left < -100 || left > 100 || right < -100 || right > 100) {
+            Reply_Begin(&r, "ERR,range:");
+            Reply_Str(&r, cmd);
+            Reply_Send(&r);
+            return;
+        }
+        Velocity_Set((int8_t)left, (int8_t)right);
+        Reply_Begin(&r, "OK,V,");
+        Reply_Int(&r, left);
+        Reply_Char(&r, ',');
+        Reply_Int(&r, right);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // DEADMAN,<ms> - 速度模式看门狗时间
+    if (strncmp(cmd, "DEADMAN,", 8) == 0) {
+        char *end;
+        long ms = strtol(cmd + 8, &end, 10);
+        Reply r;
+        
+        if (end == cmd + 8 || *end != '\0' || ms < 50 || ms > 5000) {
+            Reply_Begin(&r, "ERR,range:");
+            Reply_Str(&r, cmd);
+            Reply_Send(&r);
+            return;
+        }
+        velDeadmanMs = (uint16_t)ms;
+        Reply_Begin(&r, "OK,DEADMAN,");
+        Reply_Uint(&r, velDeadmanMs);
+        Reply_Send(&r);
+        return;
+    }
+    
+    // BIN - 切换到二进制帧协议（先用文本回复，再切换）
+    if (strcmp(cmd, "BIN") == 0) {
+        static const uint8_t delimiter = 0x00;
+        Reply_Line("OK,BIN");
+        binaryMode = 1;
+        UartTx_Write(&delimiter, 1);    // 帧分隔符，让主机丢弃切换前的残余字节
         return;
     }
     
@@ -417,53 +1937,211 @@ static void ProcessCommand(char *cmd)
     if (len >= 3 && cmd[1] == ',') {
         ms = (uint16_t)atoi(cmd + 2);
         
-        switch (cmd[0]) {
-            case 'F':
-                Motor_Forward(ms);
-                printf("OK,F,%d\r\n", ms);
-                break;
-            case 'B':
-                Motor_Backward(ms);
-                printf("OK,B,%d\r\n", ms);
-                break;
-            case 'L':
-                Motor_Left(ms);
-                printf("OK,L,%d\r\n", ms);
-                break;
-            case 'R':
-                Motor_Right(ms);
-                printf("OK,R,%d\r\n", ms);
-                break;
-            default:
-                printf("ERR,unknown:%s\r\n", cmd);
-                break;
+        if (Motion_Run(cmd[0], 0, ms)) {
+            Reply r;
+            Reply_Begin(&r, "OK,");
+            Reply_Char(&r, cmd[0]);
+            Reply_Char(&r, ',');
+            Reply_Uint(&r, ms);
+            Reply_Send(&r);
+            return;
         }
+    }
+    
+    Reply_Unknown(cmd);
+}
+
+// ============ 二进制帧收发 ============
+// 组帧并发送：COBS 编码 [type][seq][payload][crc16] + 0x00
+static void Frame_Send(uint8_t type, uint8_t seq, const uint8_t *payload, uint8_t len)
+{
+    uint8_t raw[FRAME_MAX_RAW];
+    uint8_t out[FRAME_MAX_ENCODED];
+    uint8_t i, o = 1, codeIdx = 0, code = 1;
+    uint16_t crc;
+    
+    if (len > FRAME_MAX_PAYLOAD) len = FRAME_MAX_PAYLOAD;
+    raw[0] = type;
+    raw[1] = seq;
+    for (i = 0; i < len; i++) raw[2 + i] = payload[i];
+    crc = Crc16_Ccitt(raw, len + 2);
+    raw[len + 2] = crc & 0xFF;
+    raw[len + 3] = crc >> 8;
+    
+    for (i = 0; i < len + 4; i++) {
+        if (raw[i] == 0) {
+            out[codeIdx] = code;
+            codeIdx = o++;
+            code = 1;
+        } else {
+            out[o++] = raw[i];
+            code++;
+        }
+    }
+    out[codeIdx] = code;
+    
+    out[o++] = 0x00;
+    UartTx_Write(out, o);
+}
+
+static void Frame_Ack(uint8_t seq, uint8_t type, uint8_t ok)
+{
+    uint8_t payload[2];
+    payload[0] = ok ? 0 : 1;
+    payload[1] = type;
+    Frame_Send(FRAME_ACK, seq, payload, 2);
+}
+
+static void Frame_SendSensor(uint8_t seq)
+{
+    uint8_t payload[7];
+    uint32_t t = sysTickMs;
+    int dist = Ultrasonic_Distance();
+    
+    payload[0] = dist & 0xFF;
+    payload[1] = dist >> 8;
+    payload[2] = (IrObstacle_Left() ? SENSOR_FLAG_OBS_L : 0) |
+                 (IrObstacle_Right() ? SENSOR_FLAG_OBS_R : 0) |
+                 (IrTracking_Left() ? SENSOR_FLAG_TRK_L : 0) |
+                 (IrTracking_Right() ? SENSOR_FLAG_TRK_R : 0) |
+                 (usValid ? 0 : SENSOR_FLAG_DIST_BAD);
+    payload[3] = t & 0xFF;
+    payload[4] = (t >> 8) & 0xFF;
+    payload[5] = (t >> 16) & 0xFF;
+    payload[6] = t >> 24;
+    Frame_Send(FRAME_SENSOR, seq, payload, 7);
+}
+
+// 处理一个已收到的帧（不含结尾 0x00）
+static void Frame_Process(const uint8_t *data, uint8_t len)
+{
+    uint8_t raw[FRAME_MAX_RAW];
+    char text[FRAME_MAX_PAYLOAD + 1];
+    uint8_t n, type, seq, plen;
+    const uint8_t *p;
+    
+    n = Cobs_Decode(data, len, raw, sizeof(raw));
+    if (n < 4) return;
+    if (Crc16_Ccitt(raw, n - 2) != (uint16_t)(raw[n - 2] | (raw[n - 1] << 8))) return;
+    
+    type = raw[0];
+    seq = raw[1];
+    p = raw + 2;
+    plen = n - 4;
+    
+    // 急停之前入队的 MOVE / VEL 帧回 ERR；TEXT 帧交给 ProcessCommand 回 ERR,stopped
+    if (rxCancelled && type != FRAME_TEXT) {
+        Frame_Ack(seq, type, 0);
         return;
     }
     
-    printf("ERR,unknown:%s\r\n", cmd);
+    switch (type) {
+        case FRAME_MOVE:
+            if (plen < 4) {
+                Frame_Ack(seq, type, 0);
+                break;
+            }
+            Frame_Ack(seq, type, Motion_Run((char)p[0], p[1], p[2] | (p[3] << 8)));
+            break;
+            
+        case FRAME_VEL:
+            if (plen < 2 || (int8_t)p[0] < -100 || (int8_t)p[0] > 100 ||
+                (int8_t)p[1] < -100 || (int8_t)p[1] > 100) {
+                Frame_Ack(seq, type, 0);
+                break;
+            }
+            Velocity_Set((int8_t)p[0], (int8_t)p[1]);
+            Frame_Ack(seq, type, 1);
+            break;
+            
+        case FRAME_STOP:
+            Motor_Stop();
+            Frame_Ack(seq, type, 1);
+            break;
+            
+        case FRAME_PING:
+            Frame_Send(FRAME_PONG, seq, 0, 0);
+            break;
+            
+        case FRAME_SENSOR_REQ:
+            Frame_SendSensor(seq);
+            break;
+            
+        case FRAME_TEXT:
+            // 复用文本命令处理，文本回复装进 TEXT_REPLY 帧
+            memcpy(text, p, plen);
+            text[plen] = '\0';
+            replyLength = 0;
+            replyCapture = 1;
+            ProcessCommand(text);
+            replyCapture = 0;
+            while (replyLength > 0 && (replyBuffer[replyLength - 1] == '\r' || replyBuffer[replyLength - 1] == '\n')) {
+                replyLength--;
+            }
+            Frame_Send(FRAME_TEXT_REPLY, seq, (const uint8_t *)replyBuffer, replyLength);
+            break;
+            
+        case FRAME_TEXT_MODE:
+            Frame_Ack(seq, type, 1);
+            binaryMode = 0;
+            break;
+            
+        default:
+            Frame_Ack(seq, type, 0);
+            break;
+    }
+}
+
+// ============ 串口接收 ============
+// 处理 DMA 已写入但尚未处理的字节（USART IDLE / DMA 半满、全满中断中调用）；
+// 紧急停车：SerialRx 在这里识别 S / STOP 帧直接关 PWM（队列满也照样停车），回复仍由主循环按顺序发出
+static void UartRx_Drain(void)
+{
+    uint8_t pos = RX_DMA_SIZE - DMA_GetCurrDataCounter(DMA1_Channel5);
+    
+    if (pos >= RX_DMA_SIZE) pos = 0;
+    while (rxDmaPos != pos) {
+        SerialRx_Byte(&rx, rxDma[rxDmaPos], binaryMode);
+        if (++rxDmaPos >= RX_DMA_SIZE) rxDmaPos = 0;
+    }
 }
 
-// ============ 串口中断 ============
 void USART1_IRQHandler(void)
 {
-    if (USART_GetITStatus(USART1, USART_IT_RXNE) != RESET) {
-        char ch = USART_ReceiveData(USART1);
-        
-        if (ch == '\n' || ch == '\r') {
-            if (rxIndex > 0) {
-                rxBuffer[rxIndex] = '\0';
-                rxComplete = 1;
-                rxIndex = 0;
-            }
-        }
-        else if (rxIndex < sizeof(rxBuffer) - 1) {
-            rxBuffer[rxIndex++] = ch;
-        }
-        else {
-            rxIndex = 0;
-        }
+    if (USART_GetITStatus(USART1, USART_IT_IDLE) != RESET) {
+        USART_ReceiveData(USART1);    // 读 SR 后读 DR 清除 IDLE
+        UartRx_Drain();
+    }
+}
+
+void DMA1_Channel5_IRQHandler(void)
+{
+    if (DMA_GetITStatus(DMA1_IT_HT5) != RESET) {
+        DMA_ClearITPendingBit(DMA1_IT_HT5);
+    }
+    if (DMA_GetITStatus(DMA1_IT_TC5) != RESET) {
+        DMA_ClearITPendingBit(DMA1_IT_TC5);
+    }
+    UartRx_Drain();
+}
+
+// 主循环：处理队列中的下一条命令，队列空返回 0
+static uint8_t UartRx_ProcessNext(void)
+{
+    RxMsg *msg = SerialRx_Peek(&rx);
+    
+    if (!msg) return 0;
+    
+    // 处理期间该槽位仍归主循环所有，处理完再释放
+    rxCancelled = SerialRx_Cancelled(&rx, msg);
+    if (msg->binary) {
+        if (binaryMode) Frame_Process((const uint8_t *)msg->data, msg->len);
+    } else if (!binaryMode) {
+        ProcessCommand(msg->data);
     }
+    rxCancelled = 0;
+    SerialRx_Pop(&rx);
+    return 1;
 }
 
 // ============ 主函数 ============
@@ -473,12 +2151,16 @@ int main(void)
     
     // 初始化所有硬件
     USART1_Init();
+    UartRx_Init();
+    UartTx_Init();
     Motor_Init();
     Buzzer_Init();
     IrObstacle_Init();
     IrTracking_Init();
     Ultrasonic_Init();
+    Encoder_Init();
     Key_Init();
+    SysTick_Init();    // 最后启动：SysTick 中会驱动电机/超声波
     
     // 确保电机停止
     Motor_Stop();
@@ -488,13 +2170,28 @@ int main(void)
     
     // 启动提示
     Buzzer_Beep(100);
-    printf("\r\nSimo Full Ready!\r\n");
+    Reply_Line("\r\nSimo Full Ready!");
     
     while (1) {
-        if (rxComplete) {
-            rxComplete = 0;
-            ProcessCommand(rxBuffer);
-            memset(rxBuffer, 0, sizeof(rxBuffer));
+        Ultrasonic_Update();
+        Governor_Update();
+        
+        // 一次处理一条，让传感器流不被长队列饿死
+        UartRx_ProcessNext();
+        
+        Event_SegmentDone();
+        Event_Line();
+        Event_Estop();
+        Event_Deadman();
+        
+        // 传感器流：由 SysTick 定时置位
+        if (streamDue) {
+            streamDue = 0;
+            if (binaryMode) {
+                Frame_SendSensor(streamSeq++);
+            } else {
+                Sensor_ReportText();
+            }
         }
     }
 }
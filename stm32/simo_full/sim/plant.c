@@ -0,0 +1,58 @@
+/**
+ * 电机仿真模型实现，见 plant.h
+ */
+
+#include <math.h>
+#include "plant.h"
+
+// 标称参数：满电 100% PWM 约 500mm/s
+static void Wheel_Init(Wheel *w)
+{
+    w->gain = 5.5f;
+    w->tau = 0.08f;
+    w->deadband = 8.0f;
+    w->battery = 1.0f;
+    w->friction = 0.0f;
+    w->speed = 0;
+    w->travel = 0;
+    w->ticks = 0;
+}
+
+static void Wheel_Step(Wheel *w, float pwm, float mmPerTick, float dt)
+{
+    float mag = pwm > 0 ? pwm : -pwm;
+    float target = w->gain * w->battery * (mag - w->deadband) - w->friction;
+
+    if (mag <= w->deadband || target < 0) target = 0;
+    if (pwm < 0) target = -target;
+
+    w->speed += (target - w->speed) * (1.0f - expf(-dt / w->tau));
+    w->travel += w->speed * dt;
+    w->ticks = (int32_t)floor(w->travel / mmPerTick);
+}
+
+void Plant_Init(Plant *plant, float mmPerTick, float wheelBase)
+{
+    Wheel_Init(&plant->left);
+    Wheel_Init(&plant->right);
+    plant->mmPerTick = mmPerTick;
+    plant->wheelBase = wheelBase;
+    plant->x = plant->y = plant->heading = 0;
+}
+
+void Plant_Step(Plant *plant, float pwmLeft, float pwmRight, float dt)
+{
+    double l0 = plant->left.travel;
+    double r0 = plant->right.travel;
+    double dl, dr, dth;
+
+    Wheel_Step(&plant->left, pwmLeft, plant->mmPerTick, dt);
+    Wheel_Step(&plant->right, pwmRight, plant->mmPerTick, dt);
+
+    dl = plant->left.travel - l0;
+    dr = plant->right.travel - r0;
+    dth = (dr - dl) / plant->wheelBase;
+    plant->x += (dl + dr) * 0.5 * cos(plant->heading + dth * 0.5);
+    plant->y += (dl + dr) * 0.5 * sin(plant->heading + dth * 0.5);
+    plant->heading += dth;
+}
@@ -0,0 +1,37 @@
+/**
+ * 小车电机/轮子的主机仿真模型，用于在 Linux 上整定和回归测试 MotionCtrl
+ *
+ * 每个轮子是一阶直流电机：
+ *   稳态速度 = gain × battery × (|PWM| - deadband) - friction（mm/s，不小于 0）
+ *   速度以时间常数 tau 逼近稳态值
+ * 轮子转过的距离换算成编码器计数，位姿按差速模型精确积分（作为真值）。
+ */
+
+#ifndef __PLANT_H
+#define __PLANT_H
+
+#include <stdint.h>
+
+typedef struct {
+    float gain;         // mm/s 每 PWM%
+    float tau;          // 时间常数 s
+    float deadband;     // 死区 PWM%
+    float battery;      // 电量系数（1.0=满电）
+    float friction;     // 地面阻力造成的速度损失 mm/s
+    float speed;        // 当前速度 mm/s
+    double travel;      // 累计行程 mm
+    int32_t ticks;      // 编码器计数
+} Wheel;
+
+typedef struct {
+    Wheel left, right;
+    float mmPerTick;
+    float wheelBase;
+    double x, y, heading;   // 真值位姿
+} Plant;
+
+void Plant_Init(Plant *plant, float mmPerTick, float wheelBase);
+// 推进 dt 秒，PWM 在该时间内保持不变
+void Plant_Step(Plant *plant, float pwmLeft, float pwmRight, float dt);
+
+#endif
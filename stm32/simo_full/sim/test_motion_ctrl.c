@@ -0,0 +1,173 @@
+/**
+ * MotionCtrl 回归测试：控制器（10ms 周期，PWM 取整，与固件一致）驱动 plant 模型
+ *
+ *   make -C stm32/simo_full/sim test
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include "../MotionCtrl.h"
+#include "plant.h"
+
+// 与 main.c 中的参数一致
+#define ENC_TICKS_PER_REV   1560
+#define WHEEL_DIAMETER_MM   65
+#define WHEEL_BASE_MM       130
+#define CTRL_PERIOD_MS      10
+
+#define MM_PER_TICK  (3.14159265f * WHEEL_DIAMETER_MM / ENC_TICKS_PER_REV)
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { failures++; printf("  FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } \
+} while (0)
+
+typedef struct {
+    float overshoot;    // 左轮最大速度超出目标的比例
+    float settleMs;     // 左轮最后一次偏离目标 5% 以上的时间
+    float finalLeft, finalRight;
+} StepResult;
+
+typedef struct {
+    Plant plant;
+    MotionCtrl mc;
+    int32_t lastLeft, lastRight;
+    float pwmLeft, pwmRight;
+} Sim;
+
+static void Sim_Init(Sim *sim)
+{
+    Plant_Init(&sim->plant, MM_PER_TICK, WHEEL_BASE_MM);
+    MotionCtrl_Init(&sim->mc, MM_PER_TICK, WHEEL_BASE_MM);
+    sim->lastLeft = sim->lastRight = 0;
+    sim->pwmLeft = sim->pwmRight = 0;
+}
+
+// 以给定目标运行 ms 毫秒，plant 按 1ms 推进
+static StepResult Sim_Run(Sim *sim, float targetLeft, float targetRight, int ms)
+{
+    StepResult res = {0, 0, 0, 0};
+    float peak = 0;
+    int t;
+
+    sim->mc.targetLeft = targetLeft;
+    sim->mc.targetRight = targetRight;
+    for (t = 1; t <= ms; t++) {
+        Plant_Step(&sim->plant, sim->pwmLeft, sim->pwmRight, 0.001f);
+        if (t % CTRL_PERIOD_MS == 0) {
+            int32_t l = sim->plant.left.ticks, r = sim->plant.right.ticks;
+            MotionCtrl_Step(&sim->mc, l - sim->lastLeft, r - sim->lastRight,
+                            CTRL_PERIOD_MS / 1000.0f, &sim->pwmLeft, &sim->pwmRight);
+            sim->pwmLeft = (float)(int)sim->pwmLeft;
+            sim->pwmRight = (float)(int)sim->pwmRight;
+            sim->lastLeft = l;
+            sim->lastRight = r;
+        }
+        if (fabsf(sim->plant.left.speed) > peak) peak = fabsf(sim->plant.left.speed);
+        if (targetLeft != 0 && fabsf(sim->plant.left.speed - targetLeft) > 0.05f * fabsf(targetLeft)) {
+            res.settleMs = (float)t;
+        }
+    }
+    res.overshoot = targetLeft != 0 ? peak / fabsf(targetLeft) - 1.0f : 0;
+    res.finalLeft = sim->plant.left.speed;
+    res.finalRight = sim->plant.right.speed;
+    return res;
+}
+
+static void CheckStep(const char *name, float battery, float friction)
+{
+    Sim sim;
+    StepResult res;
+
+    Sim_Init(&sim);
+    sim.plant.left.battery = sim.plant.right.battery = battery;
+    sim.plant.left.friction = sim.plant.right.friction = friction;
+    res = Sim_Run(&sim, 300, 300, 1500);
+    printf("%-14s overshoot %5.1f%%  settle %4.0fms  final %5.1f mm/s\n",
+           name, res.overshoot * 100, res.settleMs, res.finalLeft);
+    CHECK(res.overshoot < 0.10f, "%s overshoot %.2f", name, res.overshoot);
+    CHECK(res.settleMs < 400, "%s settle %.0fms", name, res.settleMs);
+    CHECK(fabsf(res.finalLeft - 300) < 9, "%s final %.1f", name, res.finalLeft);
+}
+
+// 目标超过车子能力时积分不能无限累积，降回可达速度后不应长时间过冲
+static void TestWindup(void)
+{
+    Sim sim;
+    StepResult res;
+
+    Sim_Init(&sim);
+    sim.plant.left.battery = sim.plant.right.battery = 0.6f;
+    Sim_Run(&sim, 450, 450, 1000);
+    res = Sim_Run(&sim, 150, 150, 1000);
+    printf("%-14s settle %4.0fms  final %5.1f mm/s\n", "windup", res.settleMs, res.finalLeft);
+    CHECK(res.settleMs < 400, "windup settle %.0fms", res.settleMs);
+    CHECK(fabsf(res.finalLeft - 150) < 6, "windup final %.1f", res.finalLeft);
+}
+
+// 两轮特性不同（左轮弱 15%）：闭环后仍走直线，里程计与真值一致
+static void TestStraight(void)
+{
+    Sim sim;
+    float err, headingDeg;
+
+    Sim_Init(&sim);
+    sim.plant.left.gain *= 0.85f;
+    Sim_Run(&sim, 300, 300, 4000);
+    Sim_Run(&sim, 0, 0, 500);
+    err = hypotf(sim.mc.odom.x - (float)sim.plant.x, sim.mc.odom.y - (float)sim.plant.y);
+    headingDeg = (float)sim.plant.heading * 180 / 3.14159265f;
+    printf("%-14s x %6.1fmm  y %5.1fmm  heading %5.2f°  odom err %4.1fmm\n",
+           "straight", sim.plant.x, sim.plant.y, headingDeg, err);
+    CHECK(fabsf(headingDeg) < 3, "straight heading %.2f°", headingDeg);
+    CHECK(sim.plant.x > 1100 && sim.plant.x < 1300, "straight x %.1f", sim.plant.x);
+    CHECK(err < 5, "straight odom err %.1fmm", err);
+}
+
+// 原地转 90°：里程计航向误差小于 1°
+static void TestRotate(void)
+{
+    Sim sim;
+    float truth, est;
+
+    Sim_Init(&sim);
+    // 弧长 = 90° × 轮距 / 2 ≈ 102mm，150mm/s 约 680ms
+    Sim_Run(&sim, -150, 150, 680);
+    Sim_Run(&sim, 0, 0, 500);
+    truth = (float)sim.plant.heading * 180 / 3.14159265f;
+    est = sim.mc.odom.heading * 180 / 3.14159265f;
+    printf("%-14s truth %6.2f°  odom %6.2f°\n", "rotate", truth, est);
+    CHECK(truth > 80 && truth < 110, "rotate truth %.2f°", truth);
+    CHECK(fabsf(truth - est) < 1, "rotate odom %.2f° vs %.2f°", est, truth);
+}
+
+// 目标清零后 PWM 立即为 0，积分不残留
+static void TestStop(void)
+{
+    Sim sim;
+
+    Sim_Init(&sim);
+    Sim_Run(&sim, 300, 300, 500);
+    Sim_Run(&sim, 0, 0, 10);
+    CHECK(sim.pwmLeft == 0 && sim.pwmRight == 0, "stop pwm %.0f/%.0f", sim.pwmLeft, sim.pwmRight);
+    CHECK(sim.mc.left.integral == 0, "stop integral %.2f", sim.mc.left.integral);
+}
+
+int main(void)
+{
+    CheckStep("nominal", 1.0f, 0);
+    CheckStep("low battery", 0.7f, 0);
+    CheckStep("high friction", 1.0f, 60);
+    TestWindup();
+    TestStraight();
+    TestRotate();
+    TestStop();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
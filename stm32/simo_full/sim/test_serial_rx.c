@@ -0,0 +1,226 @@
+/**
+ * SerialRx 回归测试：分行/分帧、命令队列，以及队列满时 S / STOP 帧仍然停车、
+ * 之前排队的运动命令不再执行
+ *
+ *   make -C stm32/simo_full/sim test
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "../SerialRx.h"
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { failures++; printf("  FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } \
+} while (0)
+
+static int stops = 0;
+
+static void OnStop(void)
+{
+    stops++;
+}
+
+static void SendText(SerialRx *rx, const char *line)
+{
+    while (*line) SerialRx_Byte(rx, (uint8_t)*line++, 0);
+    SerialRx_Byte(rx, '\n', 0);
+}
+
+// 组帧 [type][seq][payload][crc16]，COBS 编码后逐字节送入（含结尾 0x00）
+static void SendFrame(SerialRx *rx, uint8_t type, uint8_t seq, const uint8_t *payload, uint8_t len, uint16_t crcXor)
+{
+    uint8_t raw[FRAME_MAX_RAW];
+    uint8_t out[FRAME_MAX_ENCODED];
+    uint8_t i, o = 1, codeIdx = 0, code = 1;
+    uint16_t crc;
+
+    raw[0] = type;
+    raw[1] = seq;
+    memcpy(raw + 2, payload, len);
+    crc = Crc16_Ccitt(raw, len + 2) ^ crcXor;
+    raw[len + 2] = (uint8_t)crc;
+    raw[len + 3] = (uint8_t)(crc >> 8);
+
+    for (i = 0; i < len + 4; i++) {
+        if (raw[i] == 0) {
+            out[codeIdx] = code;
+            codeIdx = o++;
+            code = 1;
+        } else {
+            out[o++] = raw[i];
+            code++;
+        }
+    }
+    out[codeIdx] = code;
+
+    for (i = 0; i < o; i++) SerialRx_Byte(rx, out[i], 1);
+    SerialRx_Byte(rx, 0, 1);
+}
+
+static int QueueCount(SerialRx *rx)
+{
+    return (rx->head - rx->tail) & (RX_QUEUE_LEN - 1);
+}
+
+static void TestTextQueue(void)
+{
+    SerialRx rx;
+    RxMsg *msg;
+
+    SerialRx_Init(&rx, OnStop);
+    stops = 0;
+    SendText(&rx, "F,500");
+    SerialRx_Byte(&rx, '\r', 0);    // \r\n 不产生空行
+    SendText(&rx, "SA");
+    SendText(&rx, "S");
+
+    CHECK(QueueCount(&rx) == 3, "queued %d", QueueCount(&rx));
+    CHECK(stops == 1, "stops %d", stops);
+    msg = SerialRx_Peek(&rx);
+    CHECK(msg && !msg->binary && strcmp(msg->data, "F,500") == 0, "first %s", msg ? msg->data : "(none)");
+    SerialRx_Pop(&rx);
+    SerialRx_Pop(&rx);
+    msg = SerialRx_Peek(&rx);
+    CHECK(msg && strcmp(msg->data, "S") == 0, "S still queued for the reply");
+    SerialRx_Pop(&rx);
+    CHECK(SerialRx_Peek(&rx) == 0, "queue empty");
+}
+
+// 主循环：按顺序取出全部命令，统计执行 / 作废的运动命令和停车命令
+typedef struct {
+    int moves;          // 执行的运动命令
+    int cancelled;      // 急停作废的运动命令
+    int others;         // 其他命令（PING 等照常执行）
+    int stopReplies;    // 处理到的 S / STOP（会回复 OK）
+    int stopIndex;      // 最后一个 S / STOP 在处理顺序中的位置
+    int count;
+} Drained;
+
+static int IsStopMsg(const RxMsg *msg)
+{
+    uint8_t raw[8];
+
+    if (!msg->binary) return msg->len == 1 && msg->data[0] == 'S';
+    return Cobs_Decode((const uint8_t *)msg->data, msg->len, raw, sizeof(raw)) == 4 && raw[0] == FRAME_STOP;
+}
+
+static Drained Drain(SerialRx *rx)
+{
+    Drained d = {0, 0, 0, 0, -1, 0};
+    RxMsg *msg;
+
+    while ((msg = SerialRx_Peek(rx)) != 0) {
+        if (SerialRx_Cancelled(rx, msg)) {
+            d.cancelled++;
+        } else if (SerialRx_IsMotion(msg)) {
+            d.moves++;
+        } else if (IsStopMsg(msg)) {
+            d.stopReplies++;
+            d.stopIndex = d.count;
+        } else {
+            d.others++;
+        }
+        d.count++;
+        SerialRx_Pop(rx);
+    }
+    return d;
+}
+
+static void TestTextStopWhenFull(void)
+{
+    SerialRx rx;
+    Drained d;
+    int i;
+
+    SerialRx_Init(&rx, OnStop);
+    stops = 0;
+    for (i = 0; i < RX_QUEUE_LEN - 1; i++) SendText(&rx, i % 2 ? "PING" : "F,500");
+    CHECK(QueueCount(&rx) == RX_QUEUE_LEN - 1, "filled %d", QueueCount(&rx));
+    CHECK(rx.dropped == 0, "dropped before full %u", (unsigned)rx.dropped);
+
+    SendText(&rx, "S");
+    CHECK(stops == 1, "S on full queue: stops %d", stops);
+    CHECK(rx.dropped == 0, "S kept for the reply, dropped %u", (unsigned)rx.dropped);
+
+    SendText(&rx, "B,500");
+    CHECK(stops == 1, "move on full queue must not stop");
+    CHECK(rx.dropped == 1, "dropped %u", (unsigned)rx.dropped);
+
+    // 排在 S 前面的运动命令全部作废，PING 照常处理，S 最后处理并回复
+    d = Drain(&rx);
+    CHECK(d.moves == 0, "queued moves executed after stop: %d", d.moves);
+    CHECK(d.cancelled == RX_QUEUE_LEN / 2, "cancelled %d", d.cancelled);
+    CHECK(d.others == RX_QUEUE_LEN / 2 - 1, "others %d", d.others);
+    CHECK(d.stopReplies == 1 && d.stopIndex == RX_QUEUE_LEN - 1, "stop reply %d at %d", d.stopReplies, d.stopIndex);
+
+    // 停车之后收到的运动命令照常执行
+    SendText(&rx, "F,300");
+    d = Drain(&rx);
+    CHECK(d.moves == 1 && d.cancelled == 0, "move after stop: %d / %d", d.moves, d.cancelled);
+}
+
+static void TestFrameStopWhenFull(void)
+{
+    static const uint8_t move[] = {'F', 0, 0xF4, 0x01};
+    static const uint8_t seq[] = "SEQ,F300";
+    SerialRx rx;
+    Drained d;
+    int i;
+
+    SerialRx_Init(&rx, OnStop);
+    stops = 0;
+    for (i = 0; i < RX_QUEUE_LEN - 2; i++) SendFrame(&rx, FRAME_MOVE, (uint8_t)i, move, sizeof(move), 0);
+    SendFrame(&rx, FRAME_TEXT, 9, seq, sizeof(seq) - 1, 0);
+    CHECK(QueueCount(&rx) == RX_QUEUE_LEN - 1, "filled %d", QueueCount(&rx));
+    CHECK(stops == 0, "move frames must not stop");
+
+    SendFrame(&rx, FRAME_STOP, 0, 0, 0, 0x5555);
+    CHECK(stops == 0, "STOP frame with bad crc must not stop");
+
+    SendFrame(&rx, FRAME_STOP, 0, 0, 0, 0);
+    CHECK(stops == 1, "STOP frame on full queue: stops %d", stops);
+    CHECK(rx.dropped == 1, "dropped %u", (unsigned)rx.dropped);
+
+    // 主循环先处理一条，腾出位置后到达的 MOVE 排在 STOP 之后
+    SerialRx_Pop(&rx);
+    SendFrame(&rx, FRAME_MOVE, 10, move, sizeof(move), 0);
+
+    d = Drain(&rx);
+    CHECK(d.moves == 1, "only the move sent after STOP runs: %d", d.moves);
+    CHECK(d.cancelled == RX_QUEUE_LEN - 2, "cancelled %d", d.cancelled);
+    CHECK(d.stopReplies == 1 && d.stopIndex == RX_QUEUE_LEN - 2, "stop reply %d at %d", d.stopReplies, d.stopIndex);
+    CHECK(d.count == RX_QUEUE_LEN, "drained %d", d.count);
+}
+
+static void TestOverflowDiscarded(void)
+{
+    SerialRx rx;
+    int i;
+
+    SerialRx_Init(&rx, OnStop);
+    stops = 0;
+    for (i = 0; i < RX_MSG_MAX + 4; i++) SerialRx_Byte(&rx, 'S', 0);
+    SerialRx_Byte(&rx, '\n', 0);
+    CHECK(QueueCount(&rx) == 0, "overlong line discarded");
+    CHECK(stops == 0, "overlong line must not stop");
+
+    SendText(&rx, "PING");
+    CHECK(QueueCount(&rx) == 1, "next line after overflow");
+}
+
+int main(void)
+{
+    TestTextQueue();
+    TestTextStopWhenFull();
+    TestFrameStopWhenFull();
+    TestOverflowDiscarded();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
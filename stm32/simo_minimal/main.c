@@ -13,6 +13,8 @@
  *   PING    心跳    → PONG
  *   BEEP    蜂鸣器  → OK,BEEP
  *   SENSOR  传感器  → SENSOR,D<dist>,OL<l>OR<r>,TL<l>TR<r>
+ * 
+ * 运动命令立即回复 OK，到时由 SysTick（1ms）停车，运动期间可随时发 S
  */
 
 #include "stm32f10x.h"
@@ -40,6 +42,12 @@ extern volatile uint8_t rxComplete;
 // 外部函数声明
 void Serial_Init(void);
 
+// ============ 运动定时 ============
+static volatile uint16_t motion_remain_ms = 0;   // 0=电机已停
+static volatile uint16_t buzzer_remain_ms = 0;
+
+static void motor_set(uint8_t l1, uint8_t l2, uint8_t r1, uint8_t r2);
+
 // ============ 延时函数 ============
 static void delay_us(uint32_t us) {
     volatile uint32_t i;
@@ -54,6 +62,21 @@ static void delay_ms(uint32_t ms) {
 
 // 串口初始化使用 Serial.c 中的 Serial_Init()
 
+// ============ SysTick ============
+static void systick_init(void) {
+    SysTick_Config(SystemCoreClock / 1000);    // 1ms
+}
+
+// 1ms 中断：运动/蜂鸣器到时关闭
+void SysTick_Handler(void) {
+    if (motion_remain_ms && --motion_remain_ms == 0) {
+        motor_set(0, 0, 0, 0);
+    }
+    if (buzzer_remain_ms && --buzzer_remain_ms == 0) {
+        GPIO_SetBits(GPIOB, GPIO_Pin_0);    // 高电平关
+    }
+}
+
 // ============ 电机 ============
 static void motor_init(void) {
     GPIO_InitTypeDef GPIO_InitStruct;
@@ -100,39 +123,24 @@ static void motor_set(uint8_t l1, uint8_t l2, uint8_t r1, uint8_t r2) {
     TIM_SetCompare4(TIM4, r2);
 }
 
-static void motor_stop(void) { motor_set(0, 0, 0, 0); }
-
-static void motor_forward(uint16_t ms) {
-    if (ms > MAX_DURATION) ms = MAX_DURATION;
-    if (ms < MIN_DURATION) ms = MIN_DURATION;
-    motor_set(MOTOR_SPEED, 0, MOTOR_SPEED, 0);
-    delay_ms(ms);
-    motor_stop();
+static void motor_stop(void) {
+    motion_remain_ms = 0;
+    motor_set(0, 0, 0, 0);
 }
 
-static void motor_backward(uint16_t ms) {
+// 设置 PWM 并开始计时，立即返回；到时由 SysTick 停车
+static void motor_run(uint8_t l1, uint8_t l2, uint8_t r1, uint8_t r2, uint16_t ms) {
     if (ms > MAX_DURATION) ms = MAX_DURATION;
     if (ms < MIN_DURATION) ms = MIN_DURATION;
-    motor_set(0, MOTOR_SPEED, 0, MOTOR_SPEED);
-    delay_ms(ms);
-    motor_stop();
+    motion_remain_ms = 0;
+    motor_set(l1, l2, r1, r2);
+    motion_remain_ms = ms;
 }
 
-static void motor_left(uint16_t ms) {
-    if (ms > MAX_DURATION) ms = MAX_DURATION;
-    if (ms < MIN_DURATION) ms = MIN_DURATION;
-    motor_set(0, 0, MOTOR_SPEED, 0);
-    delay_ms(ms);
-    motor_stop();
-}
-
-static void motor_right(uint16_t ms) {
-    if (ms > MAX_DURATION) ms = MAX_DURATION;
-    if (ms < MIN_DURATION) ms = MIN_DURATION;
-    motor_set(MOTOR_SPEED, 0, 0, 0);
-    delay_ms(ms);
-    motor_stop();
-}
+static void motor_forward(uint16_t ms)  { motor_run(MOTOR_SPEED, 0, MOTOR_SPEED, 0, ms); }
+static void motor_backward(uint16_t ms) { motor_run(0, MOTOR_SPEED, 0, MOTOR_SPEED, ms); }
+static void motor_left(uint16_t ms)     { motor_run(0, 0, MOTOR_SPEED, 0, ms); }
+static void motor_right(uint16_t ms)    { motor_run(MOTOR_SPEED, 0, 0, 0, ms); }
 
 // ============ 蜂鸣器 ============
 static void buzzer_init(void) {
@@ -147,10 +155,11 @@ static void buzzer_init(void) {
     GPIO_SetBits(GPIOB, GPIO_Pin_0);  // 初始化为关闭状态
 }
 
+// 非阻塞，到时由 SysTick 关闭
 static void buzzer_beep(uint16_t ms) {
+    buzzer_remain_ms = 0;
     GPIO_ResetBits(GPIOB, GPIO_Pin_0);  // 低电平响
-    delay_ms(ms);
-    GPIO_SetBits(GPIOB, GPIO_Pin_0);    // 高电平关
+    buzzer_remain_ms = ms;
 }
 
 // ============ 红外避障 ============
@@ -301,6 +310,7 @@ int main(void) {
     NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
     
     // 初始化
+    systick_init();
     Serial_Init();
     motor_init();
     ir_obstacle_init();
@@ -11,6 +11,8 @@
  *   S\n       停止
  *   PING\n    心跳 → PONG
  * 
+ * 运动命令立即回复 OK，到时由 SysTick（1ms）停车，运动期间可随时发 S
+ * 
  * 硬件：
  *   串口: USART1, PA9(TX), PA10(RX), 115200bps
  *   电机: TIM4 PWM, PB6/PB7(左), PB8/PB9(右)
@@ -31,6 +33,11 @@ static char rxBuffer[64];
 static volatile uint8_t rxIndex = 0;
 static volatile uint8_t rxComplete = 0;
 
+// ============ 运动定时 ============
+static volatile uint16_t motionRemainMs = 0;   // 0=电机已停
+
+static void Motor_SetSpeed(uint8_t left1, uint8_t left2, uint8_t right1, uint8_t right2);
+
 // ============ 延时函数 ============
 static void Delay_ms(uint32_t ms)
 {
@@ -39,6 +46,20 @@ static void Delay_ms(uint32_t ms)
         for (j = 0; j < 7200; j++);  // 72MHz 时约 1ms
 }
 
+// ============ SysTick ============
+static void SysTick_Init(void)
+{
+    SysTick_Config(SystemCoreClock / 1000);    // 1ms
+}
+
+// 1ms 中断：运动到时停车
+void SysTick_Handler(void)
+{
+    if (motionRemainMs && --motionRemainMs == 0) {
+        Motor_SetSpeed(0, 0, 0, 0);
+    }
+}
+
 // ============ 串口初始化 ============
 static void USART1_Init(void)
 {
@@ -162,43 +183,38 @@ static void Motor_SetSpeed(uint8_t left1, uint8_t left2, uint8_t right1, uint8_t
 // ============ 运动控制 ============
 static void Motor_Stop(void)
 {
+    motionRemainMs = 0;
     Motor_SetSpeed(0, 0, 0, 0);
 }
 
-static void Motor_Forward(uint16_t ms)
+// 设置 PWM 并开始计时，立即返回；到时由 SysTick 停车
+static void Motor_Run(uint8_t left1, uint8_t left2, uint8_t right1, uint8_t right2, uint16_t ms)
 {
     if (ms > MAX_DURATION) ms = MAX_DURATION;
     if (ms < MIN_DURATION) ms = MIN_DURATION;
-    Motor_SetSpeed(MOTOR_PWM_SPEED, 0, MOTOR_PWM_SPEED, 0);
-    Delay_ms(ms);
-    Motor_Stop();
+    motionRemainMs = 0;    // 先停止计时，避免 SysTick 在切换中途停车
+    Motor_SetSpeed(left1, left2, right1, right2);
+    motionRemainMs = ms;
+}
+
+static void Motor_Forward(uint16_t ms)
+{
+    Motor_Run(MOTOR_PWM_SPEED, 0, MOTOR_PWM_SPEED, 0, ms);
 }
 
 static void Motor_Backward(uint16_t ms)
 {
-    if (ms > MAX_DURATION) ms = MAX_DURATION;
-    if (ms < MIN_DURATION) ms = MIN_DURATION;
-    Motor_SetSpeed(0, MOTOR_PWM_SPEED, 0, MOTOR_PWM_SPEED);
-    Delay_ms(ms);
-    Motor_Stop();
+    Motor_Run(0, MOTOR_PWM_SPEED, 0, MOTOR_PWM_SPEED, ms);
 }
 
 static void Motor_Left(uint16_t ms)
 {
-    if (ms > MAX_DURATION) ms = MAX_DURATION;
-    if (ms < MIN_DURATION) ms = MIN_DURATION;
-    Motor_SetSpeed(0, 0, MOTOR_PWM_SPEED, 0);  // 只有右轮转
-    Delay_ms(ms);
-    Motor_Stop();
+    Motor_Run(0, 0, MOTOR_PWM_SPEED, 0, ms);  // 只有右轮转
 }
 
 static void Motor_Right(uint16_t ms)
 {
-    if (ms > MAX_DURATION) ms = MAX_DURATION;
-    if (ms < MIN_DURATION) ms = MIN_DURATION;
-    Motor_SetSpeed(MOTOR_PWM_SPEED, 0, 0, 0);  // 只有左轮转
-    Delay_ms(ms);
-    Motor_Stop();
+    Motor_Run(MOTOR_PWM_SPEED, 0, 0, 0, ms);  // 只有左轮转
 }
 
 // ============ 命令处理 ============
@@ -286,6 +302,7 @@ int main(void)
     NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
     
     // 初始化
+    SysTick_Init();
     USART1_Init();
     Motor_Init();
     